@@ -1,17 +1,21 @@
 /** 
  * @file DEIntQueue.cpp
- * @brief Implementation for DEIntQueue, a link-based double-ended queue that stores integers
+ * @brief Implementation for DEIntQueue, a double-ended queue that stores integers
+ *    in either a growable circular buffer (default) or an unrolled linked list
+ *    (when DEINTQUEUE_UNROLLED is defined)
  * @author Carl Mofjeld
  * @date 11/23/2020
 */
 #include "DEIntQueue.h"
+#include <new>       // placement new for pooled Nodes
+#include <utility>   // std::swap
 
 /** DEIntQueue(const DEIntQueue&)
  * @brief   Copy constructor.
  * @post    This queue contains the same entries in the same order as toCopy.
  *          The new entries are deep copies.
 */
-DEIntQueue::DEIntQueue(const DEIntQueue& toCopy) {
+DEIntQueue::DEIntQueue(const DEIntQueue& toCopy) : DEIntQueue() {
    copy(toCopy);
 }
 
@@ -31,37 +35,209 @@ DEIntQueue& DEIntQueue::operator=(const DEIntQueue& toCopy) {
    return *this;
 }
 
+/** operator=(DEIntQueue&&)
+ * @brief   Move assignment operator. Takes over another queue's storage without
+ *          copying.
+ * @param   toMove   The queue being moved from
+ * @post    This queue contains the entries toMove had, in the same order.
+ *          toMove is empty. If this queue is the same object as toMove, it is
+ *          unchanged.
+*/
+DEIntQueue& DEIntQueue::operator=(DEIntQueue&& toMove) noexcept {
+   if (this != &toMove) {
+      // Empty this queue, then trade storage so toMove is left empty
+      clear();
+      swap(toMove);
+   }
+   return *this;
+}
+
+/** numEntries()
+ * @brief   Returns the number of entries in this queue.
+ * @pre     size has been initialized.
+ * @post    The returned value is equal to the number of entries in this queue.
+ * @returns The number of entries in this queue.
+*/
+int DEIntQueue::numEntries() const {
+   return size_;
+}
+
+/** operator<<(ostream&, const DEIntQueue&)
+ * @brief   Outputs a DEIntQueue to an output stream
+ * @param   outStream      The stream to print the queue's entries to
+ * @param   queueToPrint   The queue whose entries are being printed
+ * @pre     outStream is not in an error state when the function is called
+ * @post    The entries in queueToPrint have been printed to outStream in
+ *          order from head to tail, separated by single spaces.
+ * @return  Reference to the modified stream.
+*/
+std::ostream& operator<<(std::ostream& outStream, const DEIntQueue& queueToPrint) {
+   for (auto cur = queueToPrint.begin(); cur != queueToPrint.end(); ++cur) {
+      outStream << *cur << ' ';
+   }
+   return outStream;
+}
+
+/** swap(DEIntQueue&, DEIntQueue&)
+ * @brief   Exchanges the contents of two queues in O(1).
+ * @param   lhs   The first queue
+ * @param   rhs   The second queue
+ * @post    lhs has rhs's former entries and rhs has lhs's.
+*/
+void swap(DEIntQueue& lhs, DEIntQueue& rhs) noexcept {
+   lhs.swap(rhs);
+}
+
+#ifdef DEINTQUEUE_UNROLLED
+// UNROLLED LINKED LIST STORAGE
+
+namespace {
+   /** ThreadPoolOwner
+    * @brief   Owns a thread's default NodePool. Queues can outlive the thread that
+    *          created them or move to another thread, so at thread exit the pool is
+    *          orphaned rather than deleted outright.
+   */
+   struct ThreadPoolOwner {
+      explicit ThreadPoolOwner(std::size_t nodeSize) : pool_(new NodePool(nodeSize)) { }
+      ~ThreadPoolOwner() { pool_->orphan(); }
+
+      NodePool* pool_;  // the thread's default pool
+   };
+}
+
+/** DEIntQueue()
+ * @brief   Default constructor.
+ * @post    This queue is empty and its size is 0. Its Nodes will come from the
+ *          default pool of the thread that adds its first entry, which is only
+ *          looked up and attached to then, so empty queues cost nothing extra.
+*/
+DEIntQueue::DEIntQueue() : pool_(nullptr), head_(nullptr), tail_(nullptr), size_(0) { }
+
+/** DEIntQueue(NodePool&)
+ * @brief   Constructs an empty queue that takes its Nodes from the given pool
+ *          instead of the calling thread's default pool.
+ * @param   pool     The pool to allocate and release Nodes with
+ * @pre     pool outlives this queue.
+ * @post    This queue is empty and its size is 0.
+ * @throw   std::invalid_argument if pool's blocks are smaller than nodeSize().
+*/
+DEIntQueue::DEIntQueue(NodePool& pool) : pool_(&pool), head_(nullptr), tail_(nullptr), size_(0) {
+   if (pool.blockSize() < nodeSize()) {
+      throw std::invalid_argument("NodePool blocks are too small to hold a DEIntQueue Node.");
+   }
+   pool_->attach();
+}
+
+/** DEIntQueue(DEIntQueue&&)
+ * @brief   Move constructor. Takes over another queue's Nodes without copying.
+ * @param   toMove   The queue being moved from
+ * @post    This queue contains the entries toMove had, in the same order, and
+ *          shares its pool. toMove is empty.
+*/
+DEIntQueue::DEIntQueue(DEIntQueue&& toMove) noexcept
+   : pool_(toMove.pool_), head_(toMove.head_), tail_(toMove.tail_), size_(toMove.size_) {
+   if (pool_ != nullptr) {
+      pool_->attach();
+   }
+   toMove.head_ = toMove.tail_ = nullptr;
+   toMove.size_ = 0;
+}
+
+/** swap(DEIntQueue&)
+ * @brief   Exchanges the contents of this queue with another in O(1).
+ * @param   other    The queue to exchange contents with
+ * @post    This queue has other's former entries and other has this queue's.
+ *          The pools are exchanged too, so Nodes always go back where they came from.
+*/
+void DEIntQueue::swap(DEIntQueue& other) noexcept {
+   std::swap(pool_, other.pool_);
+   std::swap(head_, other.head_);
+   std::swap(tail_, other.tail_);
+   std::swap(size_, other.size_);
+}
+
+/** nodeSize()
+ * @brief   Returns the number of bytes a NodePool block needs to hold one Node.
+ * @return  The size of a Node.
+*/
+std::size_t DEIntQueue::nodeSize() {
+   return sizeof(Node);
+}
+
+/** threadNodePool()
+ * @brief   Returns the calling thread's default NodePool, creating it on first use.
+ * @return  The calling thread's default NodePool.
+*/
+NodePool& DEIntQueue::threadNodePool() {
+   static thread_local ThreadPoolOwner owner(sizeof(Node));
+   return *owner.pool_;
+}
+
+/** newNode(int)
+ * @brief   Takes a Node from this queue's pool, attaching to the calling thread's
+ *          default pool if this queue has none yet.
+ * @param   firstIndex  Index at which the Node's (empty) range of entries starts
+ * @return  A Node with no entries in use and null links.
+*/
+DEIntQueue::Node* DEIntQueue::newNode(int firstIndex) {
+   // A default-constructed queue attaches to the thread's pool with its first Node
+   if (pool_ == nullptr) {
+      pool_ = &threadNodePool();
+      pool_->attach();
+   }
+
+   Node* node = new (pool_->allocate()) Node;
+   node->begin_ = node->end_ = firstIndex;
+   node->prev_ = node->next_ = nullptr;
+   return node;
+}
+
+/** deleteNode(Node*)
+ * @brief   Returns a Node to this queue's pool.
+ * @param   toDelete The Node being released
+*/
+void DEIntQueue::deleteNode(Node* toDelete) {
+   toDelete->~Node();
+   pool_->release(toDelete);
+}
+
 /** ~DEIntQueue()
  * @brief   Destructor.
- * @post    This queue is empty and all dynamically allocated memory has been
- *          returned to the system.
+ * @post    This queue is empty and all of its Nodes have been returned to the pool,
+ *          which no longer counts this queue as a user.
 */
 DEIntQueue::~DEIntQueue() {
    clear();
+   if (pool_ != nullptr) {
+      pool_->detach();
+   }
 }
 
 /** pushFront(int)
  * @brief   Adds an integer to the front of this queue.
  * @param   newItem  The integer being added to this queue.
- * @post    A new node has been inserted at the front of this
- *          queue with newItem as its data entry.
+ * @post    newItem has been inserted at the front of this queue. A new Node
+ *          has been added in front of the head if the head was full.
 */
 void DEIntQueue::pushFront(int newItem) {
-   // Create the new node
-   Node* newNode = new Node{ newItem, nullptr };
-
-   // Add it to the front
-   if (numEntries() == 0) {
-      // The queue is empty - need to update tail as well as head
-      head_ = newNode;
-      tail_ = newNode;
-   } else {
-      // The queue is not empty - need to update previous head_'s prev pointer
-      head_->prev_ = newNode;
-      newNode->next_ = head_;
-      head_ = newNode;
+   // Add a new Node if there is no room in front of the first entry
+   if (head_ == nullptr || head_->begin_ == 0) {
+      // Entries are added to a front Node from its end towards its start
+      Node* added = newNode(kNodeCapacity);
+      added->next_ = head_;
+
+      if (head_ == nullptr) {
+         // The queue is empty - need to update tail as well as head
+         tail_ = added;
+      } else {
+         head_->prev_ = added;
+      }
+      head_ = added;
    }
 
+   // Store the item just before the current first entry
+   head_->data_[--head_->begin_] = newItem;
+
    // Update number of entries
    ++size_;
 }
@@ -69,25 +245,28 @@ void DEIntQueue::pushFront(int newItem) {
 /** pushBack(int)
  * @brief   Adds an integer to the back of this queue.
  * @param   newItem  The integer being added to this queue.
- * @post    A new node has been inserted at the back of this
- *          queue with newItem as its data entry.
+ * @post    newItem has been inserted at the back of this queue. A new Node
+ *          has been added after the tail if the tail was full.
 */
 void DEIntQueue::pushBack(int newItem) {
-   // Create the new node
-   Node* newNode = new Node{ newItem, nullptr };
-
-   // Add it to the front
-   if (numEntries() == 0) {
-      // The queue is empty - need to update tail as well as head
-      head_ = newNode;
-      tail_ = newNode;
-   } else {
-      // The queue is not empty - need to update previous tail's next pointer
-      tail_->next_ = newNode;
-      newNode->prev_ = tail_;
-      tail_ = newNode;
+   // Add a new Node if there is no room after the last entry
+   if (tail_ == nullptr || tail_->end_ == kNodeCapacity) {
+      // Entries are added to a back Node from its start towards its end
+      Node* added = newNode(0);
+      added->prev_ = tail_;
+
+      if (tail_ == nullptr) {
+         // The queue is empty - need to update head as well as tail
+         head_ = added;
+      } else {
+         tail_->next_ = added;
+      }
+      tail_ = added;
    }
 
+   // Store the item just after the current last entry
+   tail_->data_[tail_->end_++] = newItem;
+
    // Update number of entries
    ++size_;
 }
@@ -105,7 +284,7 @@ int DEIntQueue::front() const {
       throw std::logic_error("DEIntQueue::front() called on empty queue.");
    }
 
-   return head_->data_;
+   return head_->data_[head_->begin_];
 }
 
 /** back()
@@ -121,230 +300,484 @@ int DEIntQueue::back() const {
       throw std::logic_error("DEIntQueue::back() called on empty queue.");
    }
 
-   return tail_->data_;
+   return tail_->data_[tail_->end_ - 1];
 }
 
 /** popFront()
  * @brief   Removes one integer from the front of this queue.
- * @post    The first integer in this queue has been removed and its associated
- *          dynamic memory has been deallocated.
+ * @post    The first integer in this queue has been removed. If that left the
+ *          head Node empty, the Node has been returned to the pool.
  * @throw   std::logic_error if this queue is empty.
 */
 void DEIntQueue::popFront() {
    // Check for empty queue
    if (numEntries() <= 0) {
-      throw std::logic_error("DEIntQueue::front() called on empty queue.");
+      throw std::logic_error("DEIntQueue::popFront() called on empty queue.");
    }
 
-   Node* toDelete = head_;  // the node to delete
-
-   // Update the queue
-   if (numEntries() == 1) {
-      // Need to update both head and tail pointers
-      head_ = tail_ = nullptr;
-   } else {
-      // Need to update prev pointer of next node in the queue
+   // Drop the first entry and unlink the head Node if it is now empty
+   ++head_->begin_;
+   --size_;
+   if (head_->begin_ == head_->end_) {
+      Node* toDelete = head_;  // the node to delete
       head_ = head_->next_;
-      head_->prev_ = nullptr;
+      if (head_ == nullptr) {
+         tail_ = nullptr;
+      } else {
+         head_->prev_ = nullptr;
+      }
+      deleteNode(toDelete);
    }
-   --size_;
-
-   // Deallocate the deleted node
-   delete toDelete;
-   toDelete = nullptr;
 }
 
 /** popBack()
  * @brief   Removes one integer from the back of this queue.
- * @post    The last integer in this queue has been removed and its associated
- *          dynamic memory has been deallocated.
+ * @post    The last integer in this queue has been removed. If that left the
+ *          tail Node empty, the Node has been returned to the pool.
  * @throw   std::logic_error if this queue is empty.
 */
 void DEIntQueue::popBack() {
    // Check for empty queue
    if (numEntries() <= 0) {
-      throw std::logic_error("DEIntQueue::front() called on empty queue.");
+      throw std::logic_error("DEIntQueue::popBack() called on empty queue.");
    }
 
-   Node* toDelete = tail_;  // the node to delete
-
-   // Update the queue
-   if (numEntries() == 1) {
-      // Need to update both head and tail pointers
-      head_ = tail_ = nullptr;
-   } else {
-      // Need to update next pointer of previous node in the queue
+   // Drop the last entry and unlink the tail Node if it is now empty
+   --tail_->end_;
+   --size_;
+   if (tail_->begin_ == tail_->end_) {
+      Node* toDelete = tail_;  // the node to delete
       tail_ = tail_->prev_;
-      tail_->next_ = nullptr;
+      if (tail_ == nullptr) {
+         head_ = nullptr;
+      } else {
+         tail_->next_ = nullptr;
+      }
+      deleteNode(toDelete);
    }
-   --size_;
-
-   // Deallocate the deleted node
-   delete toDelete;
-   toDelete = nullptr;
-}
-
-/** numEntries()
- * @brief   Returns the number of entries in this queue.
- * @pre     size has been initialized.
- * @post    The returned value is equal to the number of entries in this queue.
- * @returns The number of entries in this queue.
-*/
-int DEIntQueue::numEntries() const {
-   return size_;
 }
 
 /** clear
  * @brief   Removes all the entries from this queue.
- * @post    This queue is empty and all dynamically allocated memory has been
- *          returned to the system.
+ * @post    This queue is empty and all of its Nodes have been returned to the pool.
 */
 void DEIntQueue::clear() {
-   while (numEntries() > 0) {
-      popFront();
+   while (head_ != nullptr) {
+      Node* toDelete = head_;  // the node to delete
+      head_ = head_->next_;
+      deleteNode(toDelete);
    }
+   tail_ = nullptr;
    size_ = 0;
 }
 
+/** reserve(int)
+ * @brief   Makes room for at least minCapacity entries without reallocating.
+ * @param   minCapacity The number of entries this queue should be able to hold
+ * @post    Nothing changes: the unrolled list allocates one Node at a time, so
+ *          there is never a reallocation to avoid.
+*/
+void DEIntQueue::reserve(int minCapacity) {
+   (void)minCapacity;
+}
+
 /** copy
  * @brief   Copies the contents of another queue into this queue.
  * @param   toCopy   The queue being copied
  * @pre     This queue is empty and toCopy is not the same queue as this one.
- * @post    This queue contains the same entries in the same order as toCopy.
- *          The new entries are deep copies.
+ * @post    This queue contains the same entries in the same order as toCopy,
+ *          packed into full Nodes. The new entries are deep copies.
 */
 void DEIntQueue::copy(const DEIntQueue& toCopy) {
-   size_ = 0;
-   if (toCopy.head_ == nullptr) {
-      // Other list is empty
-      head_ = tail_ = nullptr;
-   } else {
-      for (Node* copyCur = toCopy.tail_; copyCur != nullptr; copyCur = copyCur->prev_) {
-         pushFront(copyCur->data_);
+   for (const Node* copyCur = toCopy.head_; copyCur != nullptr; copyCur = copyCur->next_) {
+      for (int i = copyCur->begin_; i < copyCur->end_; ++i) {
+         pushBack(copyCur->data_[i]);
       }
    }
 }
 
-/** operator<<(ostream&, const DEIntQueue&)
- * @brief   Outputs a DEIntQueue to an output stream
- * @param   outStream      The stream to print the queue's entries to
- * @param   queueToPrint   The queue whose entries are being printed
- * @pre     outStream is not in an error state when the function is called
- * @post    The entries in queueToPrint have been printed to outStream in
- *          order from head to tail, separated by single spaces.
- * @return  Reference to the modified stream.
+/** begin()
+ * @brief   Returns an iterator that references the first entry in this queue.
+ * @post    The returned iterator references this queue and its first entry.
+ *          If this queue is empty, the iterator does not reference any entry
+ *          and is equivalent to the one returned by end().
+ * @return  An iterator that references the first entry in this queue.
 */
-std::ostream& operator<<(std::ostream& outStream, const DEIntQueue& queueToPrint) {
-   for (DEIntQueue::Node* cur = queueToPrint.head_; cur != nullptr; cur = cur->next_) {
-      outStream << cur->data_ << ' ';
+DEIntQueue::iterator DEIntQueue::begin() {
+   return head_ == nullptr ? end() : iterator(head_, head_->begin_);
+}
+
+/** begin()
+ * @brief   Returns a const_iterator that references the first entry in this queue.
+ * @post    The returned const_iterator references this queue's first entry.
+ *          If this queue is empty, the const_iterator does not reference any entry
+ *          and is equivalent to the one returned by end().
+ * @return  A const_iterator that references the first entry in this queue.
+*/
+DEIntQueue::const_iterator DEIntQueue::begin() const {
+   return head_ == nullptr ? end() : const_iterator(head_, head_->begin_);
+}
+
+/** last()
+ * @brief   Returns an iterator that references the last entry in this queue.
+ * @post    The returned iterator references this queue and its last entry.
+ *          If this queue is empty, the iterator does not reference any entry
+ *          and is equivalent to the one returned by end().
+ * @return  An iterator that references the last entry in this queue.
+*/
+DEIntQueue::iterator DEIntQueue::last() {
+   return tail_ == nullptr ? end() : iterator(tail_, tail_->end_ - 1);
+}
+
+/** last()
+ * @brief   Returns a const_iterator that references the last entry in this queue.
+ * @post    The returned const_iterator references this queue's last entry.
+ *          If this queue is empty, the const_iterator does not reference any entry
+ *          and is equivalent to the one returned by end().
+ * @return  A const_iterator that references the last entry in this queue.
+*/
+DEIntQueue::const_iterator DEIntQueue::last() const {
+   return tail_ == nullptr ? end() : const_iterator(tail_, tail_->end_ - 1);
+}
+
+/** end()
+ * @brief   Returns an iterator that represents the end of this queue.
+ * @post    The returned iterator does not reference any entry.
+ * @return  An iterator that represents the end of this queue.
+*/
+DEIntQueue::iterator DEIntQueue::end() {
+   return iterator(nullptr, 0);
+}
+
+/** end()
+ * @brief   Returns a const_iterator that represents the end of this queue.
+ * @post    The returned const_iterator does not reference any entry.
+ * @return  An const_iterator that represents the end of this queue.
+*/
+DEIntQueue::const_iterator DEIntQueue::end() const {
+   return const_iterator(nullptr, 0);
+}
+
+/** operator==()
+ * @brief   Equality operator.
+ * @param   other    The iterator being compared to
+ * @post    Returns true if the two iterators reference the same entry of the same Node.
+ *          Returns false otherwise.
+ * @return  True if the two iterators reference the same entry. False otherwise.
+*/
+bool DEIntQueue::iterator::operator==(const iterator& other) const {
+   return node_ == other.node_ && index_ == other.index_;
+}
+
+/** operator==()
+ * @brief   Equality operator.
+ * @param   other    The const_iterator being compared to
+ * @post    Returns true if the two const_iterators reference the same entry of the same Node.
+ *          Returns false otherwise.
+ * @return  True if the two const_iterators reference the same entry. False otherwise.
+*/
+bool DEIntQueue::const_iterator::operator==(const const_iterator& other) const {
+   return node_ == other.node_ && index_ == other.index_;
+}
+
+/** referencesEntry()
+ * @brief   Checks whether this iterator references an entry.
+ * @return  False if this iterator is equivalent to end(), true otherwise.
+*/
+bool DEIntQueue::iterator::referencesEntry() const {
+   return node_ != nullptr;
+}
+
+/** stepForward()
+ * @brief   Moves to the next entry, crossing into the next Node when this one is
+ *          used up. Moving past the last entry leaves the iterator equal to end().
+ * @pre     This iterator references an entry.
+*/
+void DEIntQueue::iterator::stepForward() {
+   if (++index_ == node_->end_) {
+      node_ = node_->next_;
+      index_ = node_ == nullptr ? 0 : node_->begin_;
    }
-   return outStream;
 }
 
-// ITERATOR
+/** stepBack()
+ * @brief   Moves to the preceding entry, crossing into the previous Node when
+ *          needed. Moving before the first entry leaves the iterator equal to end().
+ * @pre     This iterator references an entry.
+*/
+void DEIntQueue::iterator::stepBack() {
+   if (index_ == node_->begin_) {
+      node_ = node_->prev_;
+      index_ = node_ == nullptr ? 0 : node_->end_ - 1;
+   } else {
+      --index_;
+   }
+}
 
-/** operator++()
- * @brief   Prefix increment. Advances to the next item in its DEIntQueue.
- * @pre     cur is not null.
- * @post    This iterator references the next item that occurs in its DEIntQueue.
- *          If the previous item was the last, then cur is set to null.
- * @return  Reference to this iterator.
- * @throw   std::out_of_range if cur is null.
+/** entry()
+ * @brief   Returns the entry this iterator references.
+ * @pre     This iterator references an entry.
 */
-DEIntQueue::iterator& DEIntQueue::iterator::operator++() {
-   if (cur_ == nullptr) {
-      throw std::out_of_range("Called increment on DEIntQueue::iterator that references no entry.");
+int& DEIntQueue::iterator::entry() const {
+   return node_->data_[index_];
+}
+
+/** referencesEntry()
+ * @brief   Checks whether this const_iterator references an entry.
+ * @return  False if this const_iterator is equivalent to end(), true otherwise.
+*/
+bool DEIntQueue::const_iterator::referencesEntry() const {
+   return node_ != nullptr;
+}
+
+/** stepForward()
+ * @brief   Moves to the next entry, crossing into the next Node when this one is
+ *          used up. Moving past the last entry leaves the const_iterator equal to end().
+ * @pre     This const_iterator references an entry.
+*/
+void DEIntQueue::const_iterator::stepForward() {
+   if (++index_ == node_->end_) {
+      node_ = node_->next_;
+      index_ = node_ == nullptr ? 0 : node_->begin_;
    }
-   cur_ = cur_->next_;
-   return *this;
 }
 
-/** operator++(int)
- * @brief   Postfix increment. Advances to the next item in its DEIntQueue.
- * @pre     cur is not null.
- * @post    This iterator references the next item that occurs in its DEIntQueue.
- *          If the previous item was the last, then cur is set to null.
- * @return  A copy of the iterator before it was modified.
- * @throw   std::out_of_range if cur is null.
+/** stepBack()
+ * @brief   Moves to the preceding entry, crossing into the previous Node when
+ *          needed. Moving before the first entry leaves the const_iterator equal to end().
+ * @pre     This const_iterator references an entry.
 */
-DEIntQueue::iterator DEIntQueue::iterator::operator++(int) {
-   if (cur_ == nullptr) {
-      throw std::out_of_range("Called increment on DEIntQueue::iterator that references no entry.");
+void DEIntQueue::const_iterator::stepBack() {
+   if (index_ == node_->begin_) {
+      node_ = node_->prev_;
+      index_ = node_ == nullptr ? 0 : node_->end_ - 1;
+   } else {
+      --index_;
    }
-   iterator copy(*this);
-   cur_ = cur_->next_;
-   return copy;
 }
 
-/** operator--()
- * @brief   Prefix decrement. Moves to the preceding item in its DEIntQueue.
- * @pre     cur is not null.
- * @post    This iterator references the preceding item that occurs in its DEIntQueue.
- *          If the previous item was the first, then cur is set to null.
- * @return  Reference to this iterator.
- * @throw   std::out_of_range if cur is null.
- */
-DEIntQueue::iterator& DEIntQueue::iterator::operator--() {
-   if (cur_ == nullptr) {
-      throw std::out_of_range("Called increment on DEIntQueue::iterator that references no entry.");
+/** entry()
+ * @brief   Returns the entry this const_iterator references.
+ * @pre     This const_iterator references an entry.
+*/
+const int& DEIntQueue::const_iterator::entry() const {
+   return node_->data_[index_];
+}
+
+#else
+// CIRCULAR BUFFER STORAGE
+
+/** DEIntQueue()
+ * @brief   Default constructor.
+ * @post    This queue is empty and its size is 0. No buffer is allocated until
+ *          the first push.
+*/
+DEIntQueue::DEIntQueue() : entries_(nullptr), capacity_(0), head_(0), size_(0) { }
+
+/** DEIntQueue(DEIntQueue&&)
+ * @brief   Move constructor. Takes over another queue's buffer without copying.
+ * @param   toMove   The queue being moved from
+ * @post    This queue contains the entries toMove had, in the same order.
+ *          toMove is empty and has no buffer.
+*/
+DEIntQueue::DEIntQueue(DEIntQueue&& toMove) noexcept
+   : entries_(toMove.entries_), capacity_(toMove.capacity_), head_(toMove.head_), size_(toMove.size_) {
+   toMove.entries_ = nullptr;
+   toMove.capacity_ = 0;
+   toMove.head_ = 0;
+   toMove.size_ = 0;
+}
+
+/** swap(DEIntQueue&)
+ * @brief   Exchanges the contents of this queue with another in O(1).
+ * @param   other    The queue to exchange contents with
+ * @post    This queue has other's former entries and other has this queue's.
+*/
+void DEIntQueue::swap(DEIntQueue& other) noexcept {
+   std::swap(entries_, other.entries_);
+   std::swap(capacity_, other.capacity_);
+   std::swap(head_, other.head_);
+   std::swap(size_, other.size_);
+}
+
+/** ~DEIntQueue()
+ * @brief   Destructor.
+ * @post    This queue is empty and its buffer has been returned to the system.
+*/
+DEIntQueue::~DEIntQueue() {
+   delete[] entries_;
+   entries_ = nullptr;
+}
+
+/** pushFront(int)
+ * @brief   Adds an integer to the front of this queue.
+ * @param   newItem  The integer being added to this queue.
+ * @post    newItem has been inserted at the front of this queue. The buffer
+ *          has been doubled in size if it was full.
+*/
+void DEIntQueue::pushFront(int newItem) {
+   // Make room if the buffer is full
+   if (size_ == capacity_) {
+      reallocate(capacity_ == 0 ? kMinCapacity : capacity_ * 2);
    }
-   cur_ = cur_->prev_;
-   return *this;
+
+   // Step the head back one slot (wrapping around) and store the item there
+   head_ = (head_ - 1) & (capacity_ - 1);
+   entries_[head_] = newItem;
+
+   // Update number of entries
+   ++size_;
 }
 
-/** operator--(int)
- * @brief   Postfix decrement. Moves to the preceding item in its DEIntQueue.
- * @pre     cur is not null.
- * @post    This iterator references the preceding item that occurs in its DEIntQueue.
- *          If the previous item was the first, then cur is set to null.
- * @return  A copy of the iterator before it was modified.
- * @throw   std::out_of_range if cur is null.
- */
-DEIntQueue::iterator DEIntQueue::iterator::operator--(int) {
-   if (cur_ == nullptr) {
-      throw std::out_of_range("Called increment on DEIntQueue::iterator that references no entry.");
+/** pushBack(int)
+ * @brief   Adds an integer to the back of this queue.
+ * @param   newItem  The integer being added to this queue.
+ * @post    newItem has been inserted at the back of this queue. The buffer
+ *          has been doubled in size if it was full.
+*/
+void DEIntQueue::pushBack(int newItem) {
+   // Make room if the buffer is full
+   if (size_ == capacity_) {
+      reallocate(capacity_ == 0 ? kMinCapacity : capacity_ * 2);
    }
-   iterator copy(*this);
-   cur_ = cur_->prev_;
-   return copy;
+
+   // Store the item in the slot just past the current last entry
+   entries_[slot(size_)] = newItem;
+
+   // Update number of entries
+   ++size_;
 }
 
-/** operator*()
- * @brief   Dereference operator. Returns a reference to the integer stored in the
- *          Node this iterator currently references.
- * @pre     cur is not null
- * @return  Reference to the integer stored in the Node this iterator currently references.
- * @throw   std::out_of_range if cur is null.
+/** front()
+ * @brief   Returns the first item in this queue.
+ * @pre     There is at least one item in this queue.
+ * @post    The returned value is equal to the first item in this queue.
+ * @return  The first item in this queue.
+ * @throw   std::logic_error if this queue is empty.
 */
-int& DEIntQueue::iterator::operator*() {
-   if (cur_ == nullptr) {
-      throw std::out_of_range("Called dereference on DEIntQueue::iterator that references no entry.");
+int DEIntQueue::front() const {
+   // Check for empty queue
+   if (numEntries() <= 0) {
+      throw std::logic_error("DEIntQueue::front() called on empty queue.");
    }
-   return cur_->data_;
+
+   return entries_[head_];
 }
 
-/** operator!=()
- * @brief   Inequality operator.
- * @param   other    The iterator being compared to
- * @post    Returns true if the two iterators do not both have the same container and same node.
- *          Returns false otherwise.
- * @return  True if the two iterators do not both the same container and same node.
- *          False otherwise.
+/** back()
+ * @brief   Returns the last integer in this queue.
+ * @pre     There is at least one integer in this queue.
+ * @post    The returned value is equal to the last integer in this queue.
+ * @return  The last integer in this queue.
+ * @throw   std::logic_error if this queue is empty.
 */
-bool DEIntQueue::iterator::operator!=(const iterator& other) const {
-   return !operator==(other);
+int DEIntQueue::back() const {
+   // Check for empty queue
+   if (numEntries() <= 0) {
+      throw std::logic_error("DEIntQueue::back() called on empty queue.");
+   }
+
+   return entries_[slot(size_ - 1)];
 }
 
-/** operator==()
- * @brief   Equality operator.
- * @param   other    The iterator being compared to
- * @post    Returns true if the two iterators both have the same container and same node.
- *          Returns false otherwise.
- * @return  True if the two iterators do not both the same container and same node.
- *          False otherwise.
+/** popFront()
+ * @brief   Removes one integer from the front of this queue.
+ * @post    The first integer in this queue has been removed. Its slot in the
+ *          buffer is kept for reuse.
+ * @throw   std::logic_error if this queue is empty.
 */
-bool DEIntQueue::iterator::operator==(const iterator& other) const {
-   return cur_ == other.cur_;
+void DEIntQueue::popFront() {
+   // Check for empty queue
+   if (numEntries() <= 0) {
+      throw std::logic_error("DEIntQueue::popFront() called on empty queue.");
+   }
+
+   // Advance the head past the removed entry
+   head_ = (head_ + 1) & (capacity_ - 1);
+   --size_;
+}
+
+/** popBack()
+ * @brief   Removes one integer from the back of this queue.
+ * @post    The last integer in this queue has been removed. Its slot in the
+ *          buffer is kept for reuse.
+ * @throw   std::logic_error if this queue is empty.
+*/
+void DEIntQueue::popBack() {
+   // Check for empty queue
+   if (numEntries() <= 0) {
+      throw std::logic_error("DEIntQueue::popBack() called on empty queue.");
+   }
+
+   // The last entry sits at slot(size_ - 1), so shrinking the size removes it
+   --size_;
+}
+
+/** clear
+ * @brief   Removes all the entries from this queue.
+ * @post    This queue is empty. The buffer is kept so that refilling the queue
+ *          does not need to allocate again.
+*/
+void DEIntQueue::clear() {
+   head_ = 0;
+   size_ = 0;
+}
+
+/** reserve(int)
+ * @brief   Makes room for at least minCapacity entries without reallocating.
+ * @param   minCapacity The number of entries this queue should be able to hold
+ * @post    The buffer can hold at least minCapacity entries. The entries in this
+ *          queue and their order are unchanged.
+*/
+void DEIntQueue::reserve(int minCapacity) {
+   if (minCapacity <= capacity_) {
+      return;
+   }
+
+   // Round up to the next power of two so slot() can wrap with a mask
+   int newCapacity = capacity_ == 0 ? kMinCapacity : capacity_;
+   while (newCapacity < minCapacity) {
+      newCapacity *= 2;
+   }
+   reallocate(newCapacity);
+}
+
+/** reallocate(int)
+ * @brief   Moves the entries into a new buffer of the given size.
+ * @param   newCapacity The size of the new buffer
+ * @pre     newCapacity is a power of two and is at least size_.
+ * @post    entries_ holds the same entries in the same order, starting at index 0,
+ *          and the old buffer has been deallocated.
+*/
+void DEIntQueue::reallocate(int newCapacity) {
+   int* newEntries = new int[newCapacity];
+
+   // Unwrap the entries so the first one lands at index 0
+   for (int i = 0; i < size_; ++i) {
+      newEntries[i] = entries_[slot(i)];
+   }
+
+   delete[] entries_;
+   entries_ = newEntries;
+   capacity_ = newCapacity;
+   head_ = 0;
+}
+
+/** copy
+ * @brief   Copies the contents of another queue into this queue.
+ * @param   toCopy   The queue being copied
+ * @pre     This queue is empty and toCopy is not the same queue as this one.
+ * @post    This queue contains the same entries in the same order as toCopy.
+ *          The new entries are deep copies.
+*/
+void DEIntQueue::copy(const DEIntQueue& toCopy) {
+   head_ = 0;
+   size_ = 0;
+   reserve(toCopy.size_);
+   for (int i = 0; i < toCopy.size_; ++i) {
+      entries_[i] = toCopy.entries_[toCopy.slot(i)];
+   }
+   size_ = toCopy.size_;
 }
 
 /** begin()
@@ -355,7 +788,7 @@ bool DEIntQueue::iterator::operator==(const iterator& other) const {
  * @return  An iterator that references the first entry in this queue.
 */
 DEIntQueue::iterator DEIntQueue::begin() {
-   return iterator(head_);
+   return iterator(this, size_ > 0 ? 0 : npos);
 }
 
 /** begin()
@@ -366,7 +799,7 @@ DEIntQueue::iterator DEIntQueue::begin() {
  * @return  A const_iterator that references the first entry in this queue.
 */
 DEIntQueue::const_iterator DEIntQueue::begin() const {
-   return const_iterator(head_);
+   return const_iterator(this, size_ > 0 ? 0 : npos);
 }
 
 /** last()
@@ -377,7 +810,7 @@ DEIntQueue::const_iterator DEIntQueue::begin() const {
  * @return  An iterator that references the last entry in this queue.
 */
 DEIntQueue::iterator DEIntQueue::last() {
-   return iterator(tail_);
+   return iterator(this, size_ - 1);
 }
 
 /** last()
@@ -388,7 +821,7 @@ DEIntQueue::iterator DEIntQueue::last() {
  * @return  A const_iterator that references the last entry in this queue.
 */
 DEIntQueue::const_iterator DEIntQueue::last() const {
-   return const_iterator(tail_);
+   return const_iterator(this, size_ - 1);
 }
 
 /** end()
@@ -398,7 +831,7 @@ DEIntQueue::const_iterator DEIntQueue::last() const {
  * @return  An iterator that represents the end of this queue.
 */
 DEIntQueue::iterator DEIntQueue::end() {
-   return iterator(nullptr);
+   return iterator(this, npos);
 }
 
 /** end()
@@ -408,111 +841,287 @@ DEIntQueue::iterator DEIntQueue::end() {
  * @return  An const_iterator that represents the end of this queue.
 */
 DEIntQueue::const_iterator DEIntQueue::end() const {
-   return const_iterator(nullptr);
+   return const_iterator(this, npos);
+}
+
+/** operator==()
+ * @brief   Equality operator.
+ * @param   other    The iterator being compared to
+ * @post    Returns true if the two iterators both have the same container and same entry.
+ *          Returns false otherwise.
+ * @return  True if the two iterators do not both the same container and same entry.
+ *          False otherwise.
+*/
+bool DEIntQueue::iterator::operator==(const iterator& other) const {
+   return container_ == other.container_ && pos_ == other.pos_;
+}
+
+/** operator==()
+ * @brief   Equality operator.
+ * @param   other    The const_iterator being compared to
+ * @post    Returns true if the two const_iterators both have the same container and same entry.
+ *          Returns false otherwise.
+ * @return  True if the two const_iterators do not both the same container and same entry.
+ *          False otherwise.
+*/
+bool DEIntQueue::const_iterator::operator==(const const_iterator& other) const {
+   return container_ == other.container_ && pos_ == other.pos_;
+}
+
+/** referencesEntry()
+ * @brief   Checks whether this iterator references an entry.
+ * @return  False if this iterator is equivalent to end(), true otherwise.
+*/
+bool DEIntQueue::iterator::referencesEntry() const {
+   return pos_ != npos;
+}
+
+/** stepForward()
+ * @brief   Moves to the next position, or to npos after the last entry.
+ * @pre     This iterator references an entry.
+*/
+void DEIntQueue::iterator::stepForward() {
+   if (++pos_ == container_->size_) {
+      pos_ = npos;  // stepped past the last entry
+   }
+}
+
+/** stepBack()
+ * @brief   Moves to the preceding position. Position 0 steps to npos (-1).
+ * @pre     This iterator references an entry.
+*/
+void DEIntQueue::iterator::stepBack() {
+   --pos_;
+}
+
+/** entry()
+ * @brief   Returns the entry at this iterator's position.
+ * @pre     This iterator references an entry.
+*/
+int& DEIntQueue::iterator::entry() const {
+   return container_->entries_[container_->slot(pos_)];
+}
+
+/** referencesEntry()
+ * @brief   Checks whether this const_iterator references an entry.
+ * @return  False if this const_iterator is equivalent to end(), true otherwise.
+*/
+bool DEIntQueue::const_iterator::referencesEntry() const {
+   return pos_ != npos;
+}
+
+/** stepForward()
+ * @brief   Moves to the next position, or to npos after the last entry.
+ * @pre     This const_iterator references an entry.
+*/
+void DEIntQueue::const_iterator::stepForward() {
+   if (++pos_ == container_->size_) {
+      pos_ = npos;  // stepped past the last entry
+   }
+}
+
+/** stepBack()
+ * @brief   Moves to the preceding position. Position 0 steps to npos (-1).
+ * @pre     This const_iterator references an entry.
+*/
+void DEIntQueue::const_iterator::stepBack() {
+   --pos_;
+}
+
+/** entry()
+ * @brief   Returns the entry at this const_iterator's position.
+ * @pre     This const_iterator references an entry.
+*/
+const int& DEIntQueue::const_iterator::entry() const {
+   return container_->entries_[container_->slot(pos_)];
+}
+
+#endif
+
+// ITERATOR
+
+/** operator++()
+ * @brief   Prefix increment. Advances to the next item in its DEIntQueue.
+ * @pre     pos is not npos.
+ * @post    This iterator references the next item that occurs in its DEIntQueue.
+ *          If the previous item was the last, then pos is set to npos.
+ * @return  Reference to this iterator.
+ * @throw   std::out_of_range if pos is npos.
+*/
+DEIntQueue::iterator& DEIntQueue::iterator::operator++() {
+   if (!referencesEntry()) {
+      throw std::out_of_range("Called increment on DEIntQueue::iterator that references no entry.");
+   }
+   stepForward();
+   return *this;
+}
+
+/** operator++(int)
+ * @brief   Postfix increment. Advances to the next item in its DEIntQueue.
+ * @pre     pos is not npos.
+ * @post    This iterator references the next item that occurs in its DEIntQueue.
+ *          If the previous item was the last, then pos is set to npos.
+ * @return  A copy of the iterator before it was modified.
+ * @throw   std::out_of_range if pos is npos.
+*/
+DEIntQueue::iterator DEIntQueue::iterator::operator++(int) {
+   if (!referencesEntry()) {
+      throw std::out_of_range("Called increment on DEIntQueue::iterator that references no entry.");
+   }
+   iterator copy(*this);
+   stepForward();
+   return copy;
+}
+
+/** operator--()
+ * @brief   Prefix decrement. Moves to the preceding item in its DEIntQueue.
+ * @pre     pos is not npos.
+ * @post    This iterator references the preceding item that occurs in its DEIntQueue.
+ *          If the previous item was the first, then pos is set to npos.
+ * @return  Reference to this iterator.
+ * @throw   std::out_of_range if pos is npos.
+ */
+DEIntQueue::iterator& DEIntQueue::iterator::operator--() {
+   if (!referencesEntry()) {
+      throw std::out_of_range("Called decrement on DEIntQueue::iterator that references no entry.");
+   }
+   stepBack();
+   return *this;
+}
+
+/** operator--(int)
+ * @brief   Postfix decrement. Moves to the preceding item in its DEIntQueue.
+ * @pre     pos is not npos.
+ * @post    This iterator references the preceding item that occurs in its DEIntQueue.
+ *          If the previous item was the first, then pos is set to npos.
+ * @return  A copy of the iterator before it was modified.
+ * @throw   std::out_of_range if pos is npos.
+ */
+DEIntQueue::iterator DEIntQueue::iterator::operator--(int) {
+   if (!referencesEntry()) {
+      throw std::out_of_range("Called decrement on DEIntQueue::iterator that references no entry.");
+   }
+   iterator copy(*this);
+   stepBack();
+   return copy;
+}
+
+/** operator*()
+ * @brief   Dereference operator. Returns a reference to the integer stored in the
+ *          entry this iterator currently references.
+ * @pre     pos is not npos.
+ * @return  Reference to the integer stored in the entry this iterator currently references.
+ * @throw   std::out_of_range if pos is npos.
+*/
+int& DEIntQueue::iterator::operator*() {
+   if (!referencesEntry()) {
+      throw std::out_of_range("Called dereference on DEIntQueue::iterator that references no entry.");
+   }
+   return entry();
+}
+
+/** operator!=()
+ * @brief   Inequality operator.
+ * @param   other    The iterator being compared to
+ * @post    Returns true if the two iterators do not both have the same container and same entry.
+ *          Returns false otherwise.
+ * @return  True if the two iterators do not both the same container and same entry.
+ *          False otherwise.
+*/
+bool DEIntQueue::iterator::operator!=(const iterator& other) const {
+   return !operator==(other);
 }
 
 // CONST ITERATOR
 
 /** operator++()
  * @brief   Prefix increment. Advances to the next item in its DEIntQueue.
- * @pre     cur is not null.
+ * @pre     pos is not npos.
  * @post    This const_iterator references the next item that occurs in its DEIntQueue.
- *          If the previous item was the last, then cur is set to null.
+ *          If the previous item was the last, then pos is set to npos.
  * @return  Reference to this const_iterator.
- * @throw   std::out_of_range if cur is null.
+ * @throw   std::out_of_range if pos is npos.
 */
 DEIntQueue::const_iterator& DEIntQueue::const_iterator::operator++() {
-   if (cur_ == nullptr) {
+   if (!referencesEntry()) {
       throw std::out_of_range("Called increment on DEIntQueue::const_iterator that references no entry.");
    }
-   cur_ = cur_->next_;
+   stepForward();
    return *this;
 }
 
 /** operator++(int)
  * @brief   Postfix increment. Advances to the next item in its DEIntQueue.
- * @pre     cur is not null.
+ * @pre     pos is not npos.
  * @post    This const_iterator references the next item that occurs in its DEIntQueue.
- *          If the previous item was the last, then cur is set to null.
+ *          If the previous item was the last, then pos is set to npos.
  * @return  A copy of the const_iterator before it was modified.
- * @throw   std::out_of_range if cur is null.
+ * @throw   std::out_of_range if pos is npos.
 */
 DEIntQueue::const_iterator DEIntQueue::const_iterator::operator++(int) {
-   if (cur_ == nullptr) {
+   if (!referencesEntry()) {
       throw std::out_of_range("Called increment on DEIntQueue::const_iterator that references no entry.");
    }
    const_iterator copy(*this);
-   cur_ = cur_->next_;
+   stepForward();
    return copy;
 }
 
 /** operator--()
  * @brief   Prefix decrement. Moves to the preceding item in its DEIntQueue.
- * @pre     cur is not null.
+ * @pre     pos is not npos.
  * @post    This const_iterator references the preceding item that occurs in its DEIntQueue.
- *          If the previous item was the first, then cur is set to null.
+ *          If the previous item was the first, then pos is set to npos.
  * @return  Reference to this const_iterator.
- * @throw   std::out_of_range if cur is null.
+ * @throw   std::out_of_range if pos is npos.
  */
 DEIntQueue::const_iterator& DEIntQueue::const_iterator::operator--() {
-   if (cur_ == nullptr) {
-      throw std::out_of_range("Called increment on DEIntQueue::const_iterator that references no entry.");
+   if (!referencesEntry()) {
+      throw std::out_of_range("Called decrement on DEIntQueue::const_iterator that references no entry.");
    }
-   cur_ = cur_->prev_;
+   stepBack();
    return *this;
 }
 
 /** operator--(int)
  * @brief   Postfix decrement. Moves to the preceding item in its DEIntQueue.
- * @pre     cur is not null.
+ * @pre     pos is not npos.
  * @post    This const_iterator references the preceding item that occurs in its DEIntQueue.
- *          If the previous item was the first, then cur is set to null.
+ *          If the previous item was the first, then pos is set to npos.
  * @return  A copy of the const_iterator before it was modified.
- * @throw   std::out_of_range if cur is null.
+ * @throw   std::out_of_range if pos is npos.
  */
 DEIntQueue::const_iterator DEIntQueue::const_iterator::operator--(int) {
-   if (cur_ == nullptr) {
-      throw std::out_of_range("Called increment on DEIntQueue::const_iterator that references no entry.");
+   if (!referencesEntry()) {
+      throw std::out_of_range("Called decrement on DEIntQueue::const_iterator that references no entry.");
    }
    const_iterator copy(*this);
-   cur_ = cur_->prev_;
+   stepBack();
    return copy;
 }
 
 /** operator*()
  * @brief   Dereference operator. Returns a reference to the integer stored in the
- *          Node this const_iterator currently references.
- * @pre     cur is not null
- * @return  Reference to the integer stored in the Node this const_iterator currently references.
- * @throw   std::out_of_range if cur is null.
+ *          entry this const_iterator currently references.
+ * @pre     pos is not npos.
+ * @return  Reference to the integer stored in the entry this const_iterator currently references.
+ * @throw   std::out_of_range if pos is npos.
 */
 const int& DEIntQueue::const_iterator::operator*() {
-   if (cur_ == nullptr) {
+   if (!referencesEntry()) {
       throw std::out_of_range("Called dereference on DEIntQueue::const_iterator that references no entry.");
    }
-   return cur_->data_;
+   return entry();
 }
 
 /** operator!=()
  * @brief   Inequality operator.
  * @param   other    The const_iterator being compared to
- * @post    Returns true if the two const_iterators do not both have the same container and same node.
+ * @post    Returns true if the two const_iterators do not both have the same container and same entry.
  *          Returns false otherwise.
- * @return  True if the two const_iterators do not both the same container and same node.
+ * @return  True if the two const_iterators do not both the same container and same entry.
  *          False otherwise.
 */
 bool DEIntQueue::const_iterator::operator!=(const const_iterator& other) const {
    return !operator==(other);
-}
-
-/** operator==()
- * @brief   Equality operator.
- * @param   other    The const_iterator being compared to
- * @post    Returns true if the two const_iterators both have the same container and same node.
- *          Returns false otherwise.
- * @return  True if the two const_iterators do not both the same container and same node.
- *          False otherwise.
-*/
-bool DEIntQueue::const_iterator::operator==(const const_iterator& other) const {
-   return cur_ == other.cur_;
 }
\ No newline at end of file
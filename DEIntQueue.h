@@ -1,12 +1,24 @@
 /** 
  * @file DEIntQueue.h
- * @brief Class definition for DEIntQueue, a link-based double-ended queue that stores integers
+ * @brief Class definition for DEIntQueue, a double-ended queue that stores integers.
+ *    By default the entries live in a growable circular buffer. Defining
+ *    DEINTQUEUE_UNROLLED switches to an unrolled linked list whose Nodes each hold
+ *    a block of DEINTQUEUE_NODE_CAPACITY entries. Those Nodes are recycled through
+ *    a NodePool (by default one per thread) instead of going back to the system.
  * @author Carl Mofjeld
  * @date 11/23/2020
 */
 
 #include <iostream>  // Stream I/O
 #include <exception> // Exceptions
+#include <stdexcept> // std::logic_error and std::out_of_range
+#ifdef DEINTQUEUE_UNROLLED
+#include "NodePool.h" // Recycles Nodes in unrolled mode
+#endif
+
+#ifndef DEINTQUEUE_NODE_CAPACITY
+#define DEINTQUEUE_NODE_CAPACITY 64  // entries per Node when DEINTQUEUE_UNROLLED is defined
+#endif
 
 class DEIntQueue {
 public:
@@ -15,7 +27,35 @@ public:
     * @brief   Default constructor.
     * @post    This queue is empty and its size is 0.
    */
-   DEIntQueue() : size_(0), head_(nullptr), tail_(nullptr) { }
+   DEIntQueue();
+
+#ifdef DEINTQUEUE_UNROLLED
+   /** DEIntQueue(NodePool&)
+    * @brief   Constructs an empty queue that takes its Nodes from the given pool
+    *          instead of the calling thread's default pool.
+    * @param   pool     The pool to allocate and release Nodes with
+    * @pre     pool outlives this queue.
+    * @post    This queue is empty and its size is 0.
+    * @throw   std::invalid_argument if pool's blocks are smaller than nodeSize().
+   */
+   explicit DEIntQueue(NodePool& pool);
+
+   /** nodeSize()
+    * @brief   Returns the number of bytes a NodePool block needs to hold one Node.
+    * @return  The size of a Node.
+   */
+   static std::size_t nodeSize();
+
+   /** threadNodePool()
+    * @brief   Returns the calling thread's default NodePool, creating it on first
+    *          use. Queues constructed without an explicit pool use this one.
+    * @post    The pool stays valid until the thread exits and every queue using it
+    *          has been destroyed. Queues may be moved to and destroyed on other
+    *          threads; their Nodes go back to the pool through its locked path.
+    * @return  The calling thread's default NodePool.
+   */
+   static NodePool& threadNodePool();
+#endif
 
    /** DEIntQueue(const DEIntQueue&)
     * @brief   Copy constructor.
@@ -34,26 +74,50 @@ public:
    */
    DEIntQueue& operator=(const DEIntQueue& toCopy);
 
+   /** DEIntQueue(DEIntQueue&&)
+    * @brief   Move constructor. Takes over another queue's storage without copying.
+    * @param   toMove   The queue being moved from
+    * @post    This queue contains the entries toMove had, in the same order.
+    *          toMove is empty.
+   */
+   DEIntQueue(DEIntQueue&& toMove) noexcept;
+
+   /** operator=(DEIntQueue&&)
+    * @brief   Move assignment operator. Takes over another queue's storage without
+    *          copying.
+    * @param   toMove   The queue being moved from
+    * @post    This queue contains the entries toMove had, in the same order.
+    *          toMove is empty. If this queue is the same object as toMove, it is
+    *          unchanged.
+   */
+   DEIntQueue& operator=(DEIntQueue&& toMove) noexcept;
+
+   /** swap(DEIntQueue&)
+    * @brief   Exchanges the contents of this queue with another in O(1).
+    * @param   other    The queue to exchange contents with
+    * @post    This queue has other's former entries and other has this queue's.
+   */
+   void swap(DEIntQueue& other) noexcept;
+
    /** ~DEIntQueue()
     * @brief   Destructor.
-    * @post    This queue is empty and all dynamically allocated memory has been
-    *          returned to the system.
+    * @post    This queue is empty and its buffer has been returned to the system.
    */
    virtual ~DEIntQueue();
 
    /** pushFront(int)
     * @brief   Adds an integer to the front of this queue.
     * @param   newItem  The integer being added to this queue.
-    * @post    A new node has been inserted at the front of this
-    *          queue with newItem as its data entry.
+    * @post    newItem has been inserted at the front of this queue. Storage is
+    *          only allocated when the buffer (or the first Node) is full.
    */
    void pushFront(int newItem);
 
    /** pushBack(int)
     * @brief   Adds an integer to the back of this queue.
     * @param   newItem  The integer being added to this queue.
-    * @post    A new node has been inserted at the back of this
-    *          queue with newItem as its data entry.
+    * @post    newItem has been inserted at the back of this queue. Storage is
+    *          only allocated when the buffer (or the last Node) is full.
    */
    void pushBack(int newItem);
 
@@ -77,16 +141,16 @@ public:
 
    /** popFront()
     * @brief   Removes one integer from the front of this queue.
-    * @post    The first integer in this queue has been removed and its associated
-    *          dynamic memory has been deallocated.
+    * @post    The first integer in this queue has been removed. A Node left
+    *          empty by the removal is returned to its NodePool.
     * @throw   std::logic_error if this queue is empty.
    */
    void popFront();
 
    /** popBack()
     * @brief   Removes one integer from the back of this queue.
-    * @post    The last integer in this queue has been removed and its associated
-    *          dynamic memory has been deallocated.
+    * @post    The last integer in this queue has been removed. A Node left
+    *          empty by the removal is returned to its NodePool.
     * @throw   std::logic_error if this queue is empty.
    */
    void popBack();
@@ -101,27 +165,87 @@ public:
 
    /** clear
     * @brief   Removes all the entries from this queue.
-    * @post    This queue is empty and all dynamically allocated memory has been
-    *          returned to the system.
+    * @post    This queue is empty. The circular buffer is kept so that refilling
+    *          the queue does not need to allocate again; Nodes go back to the NodePool.
    */
    void clear();
 
+   /** reserve(int)
+    * @brief   Makes room for at least minCapacity entries without reallocating.
+    * @param   minCapacity The number of entries this queue should be able to hold
+    * @post    The buffer can hold at least minCapacity entries. The entries in this
+    *          queue and their order are unchanged. Does nothing for the unrolled
+    *          list, which grows one Node at a time.
+   */
+   void reserve(int minCapacity);
+
 private:
+#ifdef DEINTQUEUE_UNROLLED
+   // CONSTANTS
+   static const int kNodeCapacity = DEINTQUEUE_NODE_CAPACITY;  // # of entries held by each Node
+
    /** Node
-    * @brief   Node struct used by DEIntQueue
+    * @brief   Node struct used by DEIntQueue. Holds a block of entries, of which
+    *          data_[begin_] through data_[end_ - 1] are in use.
    */
    struct Node {
-      int data_;   // integer stored in this Node
-      Node* prev_; // pointer to the previous Node in the queue
-      Node* next_; // pointer to the next Node in the queue
+      int data_[kNodeCapacity];  // integers stored in this Node
+      int begin_;                // index in data_ of the first entry in use
+      int end_;                  // index in data_ one past the last entry in use
+      Node* prev_;               // pointer to the previous Node in the queue
+      Node* next_;               // pointer to the next Node in the queue
    };
 
    // DATA MEMBERS
-   int size_;      // # of entries in the queue
+   NodePool* pool_; // pool that this queue's Nodes come from and go back to (null until a default queue's first Node)
    Node* head_;    // pointer to the first Node in the queue
    Node* tail_;    // pointer to the last Node in the queue
+   int size_;      // # of entries in the queue
+
+   // PRIVATE FUNCTIONS
+   /** newNode(int)
+    * @brief   Takes a Node from this queue's pool, attaching to the calling thread's
+    *          default pool if this queue has none yet.
+    * @param   firstIndex  Index at which the Node's (empty) range of entries starts
+    * @return  A Node with no entries in use and null links.
+   */
+   Node* newNode(int firstIndex);
+
+   /** deleteNode(Node*)
+    * @brief   Returns a Node to this queue's pool.
+    * @param   toDelete The Node being released
+   */
+   void deleteNode(Node* toDelete);
+#else
+   // CONSTANTS
+   static const int kMinCapacity = 8;  // smallest buffer allocated (must be a power of two)
+   static const int npos = -1;         // position held by iterators that reference no entry
+
+   // DATA MEMBERS
+   int* entries_;  // circular buffer holding the entries (null until the first push)
+   int capacity_;  // # of slots in entries_ (zero or a power of two)
+   int head_;      // index in entries_ of the first entry in the queue
+   int size_;      // # of entries in the queue
 
    // PRIVATE FUNCTIONS
+   /** slot(int)
+    * @brief   Maps a position in the queue to its index in the buffer.
+    * @param   position The position of an entry, counting from the front (0)
+    * @pre     0 <= position < size_
+    * @return  The index in entries_ that holds the entry at position.
+   */
+   int slot(int position) const { return (head_ + position) & (capacity_ - 1); }
+
+   /** reallocate(int)
+    * @brief   Moves the entries into a new buffer of the given size.
+    * @param   newCapacity The size of the new buffer
+    * @pre     newCapacity is a power of two and is at least size_.
+    * @post    entries_ holds the same entries in the same order, starting at index 0,
+    *          and the old buffer has been deallocated.
+   */
+   void reallocate(int newCapacity);
+#endif
+
    /** copy
     * @brief   Copies the contents of another queue into this queue.
     * @param   toCopy   The queue being copied
@@ -136,7 +260,7 @@ private:
 
 public:
    // ITERATORS
-   
+
    /** iterator
     * @brief   Iterator for DEIntQueue
    */
@@ -144,162 +268,198 @@ public:
    public:
       /** operator++()
        * @brief   Prefix increment. Advances to the next item in its DEIntQueue.
-       * @pre     cur is not null.
+       * @pre     This iterator references an entry.
        * @post    This iterator references the next item that occurs in its DEIntQueue.
-       *          If the previous item was the last, then cur is set to null.
+       *          If the previous item was the last, then it references no entry.
        * @return  Reference to this iterator.
-       * @throw   std::out_of_range if cur is null.
+       * @throw   std::out_of_range if this iterator references no entry.
       */
       iterator& operator++();
 
       /** operator++(int)
        * @brief   Postfix increment. Advances to the next item in its DEIntQueue.
-       * @pre     cur is not null.
+       * @pre     This iterator references an entry.
        * @post    This iterator references the next item that occurs in its DEIntQueue.
-       *          If the previous item was the last, then cur is set to null.
+       *          If the previous item was the last, then it references no entry.
        * @return  A copy of the iterator before it was modified.
-       * @throw   std::out_of_range if cur is null.
+       * @throw   std::out_of_range if this iterator references no entry.
       */
       iterator operator++(int);
 
       /** operator--()
        * @brief   Prefix decrement. Moves to the preceding item in its DEIntQueue.
-       * @pre     cur is not null.
+       * @pre     This iterator references an entry.
        * @post    This iterator references the preceding item that occurs in its DEIntQueue.
-       *          If the previous item was the first, then cur is set to null.
+       *          If the previous item was the first, then it references no entry.
        * @return  Reference to this iterator.
-       * @throw   std::out_of_range if cur is null.
+       * @throw   std::out_of_range if this iterator references no entry.
        */
       iterator& operator--();
 
       /** operator--(int)
        * @brief   Postfix decrement. Moves to the preceding item in its DEIntQueue.
-       * @pre     cur is not null.
+       * @pre     This iterator references an entry.
        * @post    This iterator references the preceding item that occurs in its DEIntQueue.
-       *          If the previous item was the first, then cur is set to null.
+       *          If the previous item was the first, then it references no entry.
        * @return  A copy of the iterator before it was modified.
-       * @throw   std::out_of_range if cur is null.
+       * @throw   std::out_of_range if this iterator references no entry.
        */
       iterator operator--(int);
 
       /** operator*()
        * @brief   Dereference operator. Returns a reference to the integer stored in the
-       *          Node this iterator currently references.
-       * @pre     cur is not null
-       * @return  Reference to the integer stored in the Node this iterator currently references.
-       * @throw   std::out_of_range if cur is null.
+       *          entry this iterator currently references.
+       * @pre     This iterator references an entry.
+       * @return  Reference to the integer stored in the entry this iterator currently references.
+       * @throw   std::out_of_range if this iterator references no entry.
       */
       int& operator*();
 
       /** operator!=()
        * @brief   Inequality operator.
        * @param   other    The iterator being compared to
-       * @post    Returns true if the two iterators do not reference the same node.
+       * @post    Returns true if the two iterators do not reference the same entry.
        *          Returns false otherwise.
-       * @return  True if the two iterators do not both have the same node. False otherwise.
+       * @return  True if the two iterators do not both have the same entry. False otherwise.
       */
       bool operator!=(const iterator& other) const;
 
       /** operator==()
        * @brief   Equality operator.
        * @param   other    The iterator being compared to
-       * @post    Returns true if the two iterators reference the same node.
+       * @post    Returns true if the two iterators reference the same entry.
        *          Returns false otherwise.
-       * @return  True if the two iterators do not both have the same node. False otherwise.
+       * @return  True if the two iterators do not both have the same entry. False otherwise.
       */
       bool operator==(const iterator& other) const;
 
    private:
-      /** iterator(DEIntQueue& container, DEIntQueue::Node*)
+#ifdef DEINTQUEUE_UNROLLED
+      /** iterator(DEIntQueue::Node*, int)
+       * @brief   Constructor
+       * @param   initNode    The Node holding the referenced entry, or null for none
+       * @param   initIndex   Index of the referenced entry in initNode's data
+      */
+      iterator(DEIntQueue::Node* initNode, int initIndex) : node_(initNode), index_(initIndex) {}
+
+      DEIntQueue::Node* node_;  // The Node holding the current entry referenced by the iterator
+      int index_;               // Index of the current entry in node_->data_
+#else
+      /** iterator(DEIntQueue*, int)
        * @brief   Constructor
        * @param   container   The DEIntQueue the iterator is associated with
-       * @param   
+       * @param   initPos     Position of the referenced entry, or npos for none
       */
-      iterator(DEIntQueue::Node* initCur) : cur_(initCur) {}
+      iterator(DEIntQueue* container, int initPos) : container_(container), pos_(initPos) {}
+
+      DEIntQueue* container_; // The queue whose entries are referenced
+      int pos_;               // Position of the current entry referenced by the iterator
+#endif
       friend DEIntQueue;
 
-      DEIntQueue::Node* cur_;  // The current entry referenced by the iterator
+      bool referencesEntry() const;  // true unless this iterator is equivalent to end()
+      void stepForward();            // moves to the next entry (or to end())
+      void stepBack();               // moves to the preceding entry (or to end())
+      int& entry() const;            // the entry currently referenced
    };
 
    class const_iterator{
    public:
       /** operator++()
        * @brief   Prefix increment. Advances to the next item in its DEIntQueue.
-       * @pre     cur is not null.
+       * @pre     This const_iterator references an entry.
        * @post    This const_iterator references the next item that occurs in its DEIntQueue.
-       *          If the previous item was the last, then cur is set to null.
+       *          If the previous item was the last, then it references no entry.
        * @return  Reference to this const_iterator.
-       * @throw   std::out_of_range if cur is null.
+       * @throw   std::out_of_range if this iterator references no entry.
       */
       const_iterator& operator++();
 
       /** operator++(int)
        * @brief   Postfix increment. Advances to the next item in its DEIntQueue.
-       * @pre     cur is not null.
+       * @pre     This const_iterator references an entry.
        * @post    This const_iterator references the next item that occurs in its DEIntQueue.
-       *          If the previous item was the last, then cur is set to null.
+       *          If the previous item was the last, then it references no entry.
        * @return  A copy of the const_iterator before it was modified.
-       * @throw   std::out_of_range if cur is null.
+       * @throw   std::out_of_range if this iterator references no entry.
       */
       const_iterator operator++(int);
 
       /** operator--()
        * @brief   Prefix decrement. Moves to the preceding item in its DEIntQueue.
-       * @pre     cur is not null.
+       * @pre     This const_iterator references an entry.
        * @post    This const_iterator references the preceding item that occurs in its DEIntQueue.
-       *          If the previous item was the first, then cur is set to null.
+       *          If the previous item was the first, then it references no entry.
        * @return  Reference to this const_iterator.
-       * @throw   std::out_of_range if cur is null.
+       * @throw   std::out_of_range if this iterator references no entry.
        */
       const_iterator& operator--();
 
       /** operator--(int)
        * @brief   Postfix decrement. Moves to the preceding item in its DEIntQueue.
-       * @pre     cur is not null.
+       * @pre     This const_iterator references an entry.
        * @post    This const_iterator references the preceding item that occurs in its DEIntQueue.
-       *          If the previous item was the first, then cur is set to null.
+       *          If the previous item was the first, then it references no entry.
        * @return  A copy of the const_iterator before it was modified.
-       * @throw   std::out_of_range if cur is null.
+       * @throw   std::out_of_range if this iterator references no entry.
        */
       const_iterator operator--(int);
 
       /** operator*()
        * @brief   Dereference operator. Returns a reference to the integer stored in the
-       *          Node this const_iterator currently references.
-       * @pre     cur is not null
-       * @return  Reference to the integer stored in the Node this const_iterator currently references.
-       * @throw   std::out_of_range if cur is null.
+       *          entry this const_iterator currently references.
+       * @pre     This iterator references an entry.
+       * @return  Reference to the integer stored in the entry this const_iterator currently references.
+       * @throw   std::out_of_range if this iterator references no entry.
       */
       const int& operator*();
 
       /** operator!=()
        * @brief   Inequality operator.
        * @param   other    The const_iterator being compared to
-       * @post    Returns true if the two const_iterators do not reference the same node.
+       * @post    Returns true if the two const_iterators do not reference the same entry.
        *          Returns false otherwise.
-       * @return  True if the two const_iterators do not both have the same node. False otherwise.
+       * @return  True if the two const_iterators do not both have the same entry. False otherwise.
       */
       bool operator!=(const const_iterator& other) const;
 
       /** operator==()
        * @brief   Equality operator.
        * @param   other    The const_iterator being compared to
-       * @post    Returns true if the two const_iterators reference the same node.
+       * @post    Returns true if the two const_iterators reference the same entry.
        *          Returns false otherwise.
-       * @return  True if the two const_iterators do not both have the same node. False otherwise.
+       * @return  True if the two const_iterators do not both have the same entry. False otherwise.
       */
       bool operator==(const const_iterator& other) const;
 
    private:
-      /** const_iterator(DEIntQueue& container, DEIntQueue::Node*)
+#ifdef DEINTQUEUE_UNROLLED
+      /** const_iterator(const DEIntQueue::Node*, int)
+       * @brief   Constructor
+       * @param   initNode    The Node holding the referenced entry, or null for none
+       * @param   initIndex   Index of the referenced entry in initNode's data
+      */
+      const_iterator(const DEIntQueue::Node* initNode, int initIndex) : node_(initNode), index_(initIndex) {}
+
+      const DEIntQueue::Node* node_;  // The Node holding the current entry referenced by the const_iterator
+      int index_;                     // Index of the current entry in node_->data_
+#else
+      /** const_iterator(const DEIntQueue*, int)
        * @brief   Constructor
        * @param   container   The DEIntQueue the const_iterator is associated with
-       * @param   
+       * @param   initPos     Position of the referenced entry, or npos for none
       */
-      const_iterator(const DEIntQueue::Node* initCur) : cur_(initCur) {}
+      const_iterator(const DEIntQueue* container, int initPos) : container_(container), pos_(initPos) {}
+
+      const DEIntQueue* container_; // The queue whose entries are referenced
+      int pos_;                     // Position of the current entry referenced by the const_iterator
+#endif
       friend DEIntQueue;
 
-      const DEIntQueue::Node* cur_;  // The current entry referenced by the const_iterator
+      bool referencesEntry() const;  // true unless this const_iterator is equivalent to end()
+      void stepForward();            // moves to the next entry (or to end())
+      void stepBack();               // moves to the preceding entry (or to end())
+      const int& entry() const;      // the entry currently referenced
    };
 
    /** begin()
@@ -362,4 +522,12 @@ public:
  *          order from head to tail, separated by single spaces.
  * @return  Reference to the modified stream.
 */
-std::ostream& operator<<(std::ostream& outStream, const DEIntQueue& queueToPrint);
\ No newline at end of file
+std::ostream& operator<<(std::ostream& outStream, const DEIntQueue& queueToPrint);
+
+/** swap(DEIntQueue&, DEIntQueue&)
+ * @brief   Exchanges the contents of two queues in O(1).
+ * @param   lhs   The first queue
+ * @param   rhs   The second queue
+ * @post    lhs has rhs's former entries and rhs has lhs's.
+*/
+void swap(DEIntQueue& lhs, DEIntQueue& rhs) noexcept;
\ No newline at end of file
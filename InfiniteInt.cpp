@@ -7,45 +7,168 @@
 */
 
 #include "InfiniteInt.h"
+#include <algorithm>  // std::max, std::min and std::fill
+#include <cstdint>    // std::uint32_t
+#include <cmath>      // std::isfinite, std::trunc, std::fabs, std::frexp and std::ldexp
+#include <cstdlib>    // std::abs
+#include <cstring>    // std::memcpy
+#include <string>     // std::string
+#include <vector>     // std::vector
+#include <stdexcept>  // std::invalid_argument, std::domain_error and std::length_error
+#include <utility>    // std::move and std::swap
+
+// Operand sizes, in limbs, at which operator* moves on to each faster algorithm
+int InfiniteInt::karatsubaThreshold_ = 32;
+int InfiniteInt::toom3Threshold_ = 256;
+int InfiniteInt::unbalancedToomThreshold_ = 96;
+int InfiniteInt::nttThreshold_ = 1500;
+
+// Divisor sizes, in limbs, at which division moves on to each faster algorithm
+int InfiniteInt::burnikelZieglerThreshold_ = 60;
+int InfiniteInt::newtonDivisionThreshold_ = 20000;
+
+// Operand size, in limbs, from which gcds are shortened with half-GCD. Binary
+// Lehmer steps carry with shifts rather than divisions, so they stay ahead longer.
+#ifdef INFINITEINT_BINARY
+int InfiniteInt::halfGcdThreshold_ = 10000;
+#else
+int InfiniteInt::halfGcdThreshold_ = 2000;
+#endif
 
 /** InfiniteInt()
  * @brief   Default constructor.
- * @post    This InfiniteInt has a single digit, 0, and isNegative is false.
+ * @post    This InfiniteInt represents 0, held inline.
 */
-InfiniteInt::InfiniteInt() : isNegative_(false) {
-   digits_.pushFront(0);
-}
+InfiniteInt::InfiniteInt() : isNegative_(false), isSmall_(true), small_(0) { }
 
 /** InfiniteInt(int)
  * @brief   Constructs an InfiniteInt that represents the given integer.
  * @param   num   The integer to be converted to an InfiniteInt
  * @post    This InfiniteInt has the same sign and digits as num.
 */
-InfiniteInt::InfiniteInt(int num) {
-   // Check for INT_MIN
-   if (num == INT_MIN) {
-      /* Trying to change INT_MIN to positive won't work, given that its
-         absolute value is greater than INT_MAX. Here we take off the lowest
-         digit to make num small enough to convert in the following block that
-         checks for negative inputs */
-      digits_.pushFront(abs(num % 10));
-      num /= 10;
-   }
-
-   // Check for negative input
-   if (num < 0) {
-      isNegative_ = true;
-      num = abs(num);
-   } else {
-      isNegative_ = false;
+InfiniteInt::InfiniteInt(int num) : isNegative_(num < 0), isSmall_(true), small_(num) { }
+
+/** InfiniteInt(unsigned)
+ * @brief   Constructs an InfiniteInt that represents the given integer.
+ * @param   num   The integer to be converted to an InfiniteInt
+ * @post    This InfiniteInt represents num.
+*/
+InfiniteInt::InfiniteInt(unsigned num) : isNegative_(false), isSmall_(true), small_(num) { }
+
+/** InfiniteInt(long)
+ * @brief   Constructs an InfiniteInt that represents the given integer.
+ * @param   num   The integer to be converted to an InfiniteInt
+ * @post    This InfiniteInt represents num.
+*/
+InfiniteInt::InfiniteInt(long num) : InfiniteInt(static_cast<long long>(num)) { }
+
+/** InfiniteInt(unsigned long)
+ * @brief   Constructs an InfiniteInt that represents the given integer.
+ * @param   num   The integer to be converted to an InfiniteInt
+ * @post    This InfiniteInt represents num.
+*/
+InfiniteInt::InfiniteInt(unsigned long num) : InfiniteInt(static_cast<unsigned long long>(num)) { }
+
+/** InfiniteInt(long long)
+ * @brief   Constructs an InfiniteInt that represents the given integer,
+ *          writing its limbs directly.
+ * @param   num   The integer to be converted to an InfiniteInt (LLONG_MIN included)
+ * @post    This InfiniteInt represents num.
+*/
+InfiniteInt::InfiniteInt(long long num) : isNegative_(num < 0), isSmall_(true), small_(num) {
+   if (num == LLONG_MIN) {
+      assignWord(wordMagnitude(num), true);
    }
+}
 
-   // Push digits one by one to the list of digits.
-   // Using a do/while guarantees 0 will be handled correctly.
-   do {
-      digits_.pushFront(num % 10);
-      num /= 10;
-   } while (num != 0);
+/** InfiniteInt(unsigned long long)
+ * @brief   Constructs an InfiniteInt that represents the given integer,
+ *          writing its limbs directly.
+ * @param   num   The integer to be converted to an InfiniteInt
+ * @post    This InfiniteInt represents num.
+*/
+InfiniteInt::InfiniteInt(unsigned long long num) : InfiniteInt() {
+   assignWord(num, false);
+}
+
+/** InfiniteInt(__int128)
+ * @brief   Constructs an InfiniteInt that represents the given 128-bit
+ *          integer, writing its limbs directly.
+ * @param   num   The integer to be converted to an InfiniteInt
+ * @post    This InfiniteInt represents num.
+*/
+InfiniteInt::InfiniteInt(__int128 num) : InfiniteInt() {
+   const unsigned __int128 magnitude = static_cast<unsigned __int128>(num);
+   assignWord(num < 0 ? 0 - magnitude : magnitude, num < 0);
+}
+
+/** InfiniteInt(double)
+ * @brief   Constructs an InfiniteInt that represents the integer part of a
+ *          floating point number exactly.
+ * @param   num   The number to be converted, truncated toward zero
+ * @pre     num is finite.
+ * @post    This InfiniteInt represents num with its fraction dropped. Large
+ *          doubles convert to every digit of their exact binary value.
+ * @throw   std::domain_error if num is infinite or NaN.
+*/
+InfiniteInt::InfiniteInt(double num) : InfiniteInt() {
+   if (!std::isfinite(num)) {
+      throw std::domain_error("InfiniteInt cannot represent an infinite or NaN double.");
+   }
+
+   // Every double below 2^64 in magnitude truncates exactly to a machine word
+   const double integral = std::trunc(num);
+   const double magnitude = std::fabs(integral);
+   if (magnitude < 18446744073709551616.0) {
+      assignWord(static_cast<unsigned long long>(magnitude), integral < 0);
+      return;
+   }
+
+   /* Larger doubles are integers of the form mantissa * 2^shift, with a 53-bit
+      mantissa, so scale the mantissa by an exact power of two */
+   int exponent{0};
+   const double fraction = std::frexp(magnitude, &exponent);
+   const int kMantissaBits = std::numeric_limits<double>::digits;
+   InfiniteInt mantissa(static_cast<unsigned long long>(std::ldexp(fraction, kMantissaBits)));
+   *this = mantissa * InfiniteInt(2).pow(static_cast<unsigned>(exponent - kMantissaBits));
+   isNegative_ = integral < 0;
+}
+
+/** InfiniteInt(InfiniteInt&&)
+ * @brief   Move constructor. Takes over another InfiniteInt's digits without copying.
+ * @param   toMove   The InfiniteInt being moved from
+ * @post    This InfiniteInt represents the integer toMove represented. toMove
+ *          represents 0.
+*/
+InfiniteInt::InfiniteInt(InfiniteInt&& toMove) noexcept
+   : digits_(std::move(toMove.digits_)), isNegative_(toMove.isNegative_),
+     isSmall_(toMove.isSmall_), small_(toMove.small_) {
+   toMove.setSmall(0);
+}
+
+/** operator=(InfiniteInt&&)
+ * @brief   Move assignment operator. Exchanges digits with another InfiniteInt
+ *          instead of copying them.
+ * @param   toMove   The InfiniteInt being moved from
+ * @post    This InfiniteInt represents the integer toMove represented. toMove
+ *          represents the integer this InfiniteInt held before.
+ * @return  Reference to this InfiniteInt.
+*/
+InfiniteInt& InfiniteInt::operator=(InfiniteInt&& toMove) noexcept {
+   swap(toMove);
+   return *this;
+}
+
+/** swap(InfiniteInt&)
+ * @brief   Exchanges the integers represented by this InfiniteInt and another in O(1).
+ * @param   other    The InfiniteInt to exchange with
+ * @post    This InfiniteInt represents other's former integer and vice versa.
+*/
+void InfiniteInt::swap(InfiniteInt& other) noexcept {
+   digits_.swap(other.digits_);
+   std::swap(isNegative_, other.isNegative_);
+   std::swap(isSmall_, other.isSmall_);
+   std::swap(small_, other.small_);
 }
 
 /** operator int()
@@ -60,25 +183,59 @@ InfiniteInt::InfiniteInt(int num) {
  *          representable by an int.
 */
 InfiniteInt::operator int() const {
-   // Check for range error
-   if ((InfiniteInt(INT_MAX) < *this) ||
-      (*this < InfiniteInt(INT_MIN))) {
+   // Check for range error (numbers held in limbs are always beyond LLONG_MAX)
+   if (!isSmall_ || (small_ > INT_MAX) || (small_ < INT_MIN)) {
       throw std::range_error("InfiniteInt outside range representable by int.");
    }
 
-   int result{0}; // The conversion of this InfiniteInt to an int
+   return static_cast<int>(small_);
+}
+
+/** toInt64(long long&)
+ * @brief   Converts this InfiniteInt to a long long if it fits, without
+ *          throwing or allocating.
+ * @param   value    Set to the number represented by this InfiniteInt, if it fits
+ * @post    If the number is in [LLONG_MIN, LLONG_MAX], value equals it.
+ *          Otherwise value is unchanged.
+ * @return  True if the number fit in a long long and false otherwise.
+*/
+bool InfiniteInt::toInt64(long long& value) const {
+   if (isSmall_) {
+      value = small_;
+      return true;
+   }
 
-   // Starting with the highest digit, add the digits one-by-one to the result
-   for (auto currentDigit = digits_.begin(); currentDigit != digits_.end(); ++currentDigit) {
-      result *= 10;              // Move the previous digit left
-      result += *currentDigit;   // Append the current digit
+   // Of the numbers held in limbs, only LLONG_MIN fits
+   unsigned long long magnitude{0};
+   if (!isNegative_ || !limbMagnitude(magnitude) || magnitude != wordMagnitude(LLONG_MIN)) {
+      return false;
    }
+   value = LLONG_MIN;
+   return true;
+}
 
-   // Fix the sign, if necessary, and return the result
+/** toUint64(unsigned long long&)
+ * @brief   Converts this InfiniteInt to an unsigned long long if it fits,
+ *          without throwing or allocating.
+ * @param   value    Set to the number represented by this InfiniteInt, if it fits
+ * @post    If the number is in [0, ULLONG_MAX], value equals it. Otherwise
+ *          value is unchanged.
+ * @return  True if the number fit in an unsigned long long and false otherwise.
+*/
+bool InfiniteInt::toUint64(unsigned long long& value) const {
    if (isNegative_) {
-      result *= -1;
+      return false;
+   } else if (isSmall_) {
+      value = static_cast<unsigned long long>(small_);
+      return true;
    }
-   return result;
+
+   unsigned long long magnitude{0};
+   if (!limbMagnitude(magnitude)) {
+      return false;
+   }
+   value = magnitude;
+   return true;
 }
 
 /** numDigits()
@@ -90,7 +247,56 @@ InfiniteInt::operator int() const {
  *          InfiniteInt.
 */
 int InfiniteInt::numDigits() const {
-   return digits_.numEntries();
+   if (isSmall_) {
+      // Count the digits of the inline magnitude directly
+      unsigned long long magnitude = static_cast<unsigned long long>(isNegative_ ? -small_ : small_);
+      int count{1};
+      for (; magnitude >= 10; magnitude /= 10) {
+         ++count;
+      }
+      return count;
+   }
+
+#ifdef INFINITEINT_BINARY
+   /* The magnitude has bits bits, so it is at least 2^(bits - 1) and has at least
+      floor((bits - 1) * log10(2)) + 1 digits, and at most one more. log10(2) is
+      rounded down to 64 fractional bits so the estimate never overshoots. */
+   const unsigned long long kLog10Of2 = 5553023288523357132ULL;  // floor(log10(2) * 2^64)
+   unsigned long long bits = static_cast<unsigned long long>(digits_.numEntries() - 1) * 32;
+   for (unsigned long long highest = limbValue(digits_.front()); highest != 0; highest >>= 1) {
+      ++bits;
+   }
+   int count = static_cast<int>(((bits - 1) * static_cast<unsigned __int128>(kLog10Of2)) >> 64) + 1;
+
+   // There is one more digit only if 10^count is below 2^bits, i.e. count < bits * log10(2)
+   if (count > static_cast<int>((bits * static_cast<unsigned __int128>(kLog10Of2 + 1)) >> 64)) {
+      return count;
+   }
+
+   /* Otherwise compare against 10^count. Loops tend to ask about numbers of the
+      same size, so each thread keeps the last power it built. */
+   static thread_local int powerExponent{0};
+   static thread_local LimbVector power;
+   if (power.empty() || powerExponent != count) {
+      power = InfiniteInt(10).pow(static_cast<unsigned>(count)).magnitudeLimbs();
+      powerExponent = count;
+   }
+   const int size = digits_.numEntries();
+   int comparison = size - static_cast<int>(power.size());
+   auto iter = digits_.begin();
+   for (int i = size - 1; comparison == 0 && i >= 0; --i, ++iter) {
+      const unsigned long long limb = limbValue(*iter);
+      comparison = limb < power[i] ? -1 : (limb > power[i] ? 1 : 0);
+   }
+   return comparison >= 0 ? count + 1 : count;
+#else
+   // Every limb below the highest holds exactly kChunkDigits digits (with leading zeroes)
+   int highestDigits{1};   // # of decimal digits in the highest limb
+   for (int highest = digits_.front(); highest >= 10; highest /= 10) {
+      ++highestDigits;
+   }
+   return (digits_.numEntries() - 1) * kChunkDigits + highestDigits;
+#endif
 }
 
 /** operator+(const InfiniteInt&)
@@ -102,17 +308,30 @@ int InfiniteInt::numDigits() const {
  * @return  InfiniteInt representing the sum of this InfinteInt's number and rhs's.
 */
 InfiniteInt InfiniteInt::operator+(const InfiniteInt& rhs) const {
-   InfiniteInt result;  // The result of adding the two InfiniteInts
+   InfiniteInt result;        // The result of adding the two InfiniteInts
+
+   // Use hardware arithmetic while both numbers, and their sum, are inline
+   long long smallSum{0};
+   if (isSmall_ && rhs.isSmall_ && !__builtin_add_overflow(small_, rhs.small_, &smallSum) &&
+       smallSum != LLONG_MIN) {
+      result.setSmall(smallSum);
+      return result;
+   }
+
+   InfiniteInt lhsScratch;    // limbs of this InfiniteInt, if it is inline
+   InfiniteInt rhsScratch;    // limbs of rhs, if it is inline
+   const InfiniteInt& lhsLimbs = spilled(lhsScratch);
+   const InfiniteInt& rhsLimbs = rhs.spilled(rhsScratch);
 
    // Check signs to determine which helper to call and the sign of the result
    if (isNegative_ == rhs.isNegative_) {
       // Same sign - simply add absolute values and set sign to be the same
-      result = add(*this, rhs);
+      result = add(lhsLimbs, rhsLimbs);
       result.isNegative_ = isNegative_;
    } else {
-      result = subtract(*this, rhs);
+      result = subtract(lhsLimbs, rhsLimbs);
    }
-
+   result.normalize();
    return result;
 }
 
@@ -125,17 +344,30 @@ InfiniteInt InfiniteInt::operator+(const InfiniteInt& rhs) const {
  * @return  InfiniteInt representing the difference of this InfinteInt's number and rhs's.
 */
 InfiniteInt InfiniteInt::operator-(const InfiniteInt& rhs) const {
-   InfiniteInt result;  // The result of subtracting the two InfiniteInts
+   InfiniteInt result;        // The result of subtracting the two InfiniteInts
+
+   // Use hardware arithmetic while both numbers, and their difference, are inline
+   long long smallDiff{0};
+   if (isSmall_ && rhs.isSmall_ && !__builtin_sub_overflow(small_, rhs.small_, &smallDiff) &&
+       smallDiff != LLONG_MIN) {
+      result.setSmall(smallDiff);
+      return result;
+   }
+
+   InfiniteInt lhsScratch;    // limbs of this InfiniteInt, if it is inline
+   InfiniteInt rhsScratch;    // limbs of rhs, if it is inline
+   const InfiniteInt& lhsLimbs = spilled(lhsScratch);
+   const InfiniteInt& rhsLimbs = rhs.spilled(rhsScratch);
 
    // Check signs to determine which helper to call and the sign of the result
    if (isNegative_ != rhs.isNegative_) {
       // Different signs - add the absolute values
-      result = add(*this, rhs);
+      result = add(lhsLimbs, rhsLimbs);
       result.isNegative_ = isNegative_;
    } else {
-      result = subtract(*this, rhs);
+      result = subtract(lhsLimbs, rhsLimbs);
    }
-
+   result.normalize();
    return result;
 }
 
@@ -148,307 +380,3567 @@ InfiniteInt InfiniteInt::operator-(const InfiniteInt& rhs) const {
  * @return  InfiniteInt representing the product of this InfinteInt's number and rhs's.
 */
 InfiniteInt InfiniteInt::operator*(const InfiniteInt& rhs) const {
-   InfiniteInt result{0};     // The result of multiplying the two InfiniteInts
-   int digitResult{0};        // The result of multiplying two digits
-   int carry{0};              // The carry value after multiplying two digits
-   int numZeroes{0}; // The number of zeroes to add onto partial result (effectively multiplying by powers of 10)
+   InfiniteInt result;        // The result of multiplying the two InfiniteInts
+   result.assignProduct(*this, rhs);
+   return result;
+}
+
+/** square()
+ * @brief   Squares the number represented by this InfiniteInt and returns the
+ *          result as an InfiniteInt. Squaring skips the repeated limb products
+ *          a general multiplication would compute, so it is faster than
+ *          multiplying by a copy (operator* also squares when given this
+ *          InfiniteInt itself).
+ * @post    The returned InfiniteInt represents the square of this InfiniteInt's number.
+ * @return  InfiniteInt representing the square.
+*/
+InfiniteInt InfiniteInt::square() const {
+   InfiniteInt result;        // The square of this InfiniteInt
+   result.assignSquare(*this);
+   return result;
+}
 
-   // Check if either InfiniteInt is zero
-   if ((*this == result) || (rhs == result)) {
+/** pow(unsigned)
+ * @brief   Raises the number represented by this InfiniteInt to a power and
+ *          returns the result as an InfiniteInt.
+ * @param   exponent   The power to raise this InfiniteInt's number to
+ * @post    The returned InfiniteInt represents this InfiniteInt's number raised
+ *          to exponent (1 if exponent is 0, including for zero).
+ * @return  InfiniteInt representing the power.
+ * @throw   std::length_error if the power would have more limbs than an int can count.
+*/
+InfiniteInt InfiniteInt::pow(unsigned exponent) const {
+   InfiniteInt result;        // This InfiniteInt raised to exponent
+   const bool negative = isNegative_ && (exponent & 1) != 0;
+   if (exponent == 0) {
+      result.setSmall(1);
       return result;
-   } else {
-      result.digits_.popFront();
    }
 
-   // Multiply each digit in rhs with every digit in lhs
-   for (auto rhsCur = rhs.digits_.last(); rhsCur != rhs.digits_.end(); --rhsCur) {
-      InfiniteInt partialResult;       // The result of multiplying one digit from rhs with all of lhs
-      partialResult.digits_.popFront(); // Remove default zero value
-
-      // Multiply the current digit in rhs with every digit in lhs
-      for (auto lhsCur = digits_.last(); lhsCur != digits_.end(); --lhsCur) {
-         digitResult = *lhsCur * *rhsCur + carry;           // multiply the digits
-         partialResult.digits_.pushFront(digitResult % 10);  // record the result
-         carry = digitResult / 10;                          // calculate the carry
+   // Use hardware arithmetic while the power stays inline
+   if (isSmall_) {
+      // small_ is never LLONG_MIN, so its magnitude can be taken directly
+      long long base = isNegative_ ? -small_ : small_;
+      long long power{1};
+      bool overflow{false};
+      for (unsigned bits = exponent; bits != 0 && !overflow; bits >>= 1) {
+         if ((bits & 1) != 0) {
+            overflow = __builtin_mul_overflow(power, base, &power);
+         }
+         if (bits > 1 && !overflow) {
+            overflow = __builtin_mul_overflow(base, base, &base);
+         }
       }
-
-      // Check for a final carry
-      if (carry > 0) {
-         partialResult.digits_.pushFront(carry);
+      if (!overflow) {
+         result.setSmall(negative ? -power : power);
+         return result;
       }
-      
-      // Add zeroes onto partial result to multiply by powers of ten
-      for (int i = 0; i < numZeroes; ++i) {
-         partialResult.digits_.pushBack(0);
+   }
+
+   // Whole zero limbs at the bottom of the base just shift the power up, so
+   // only the rest is raised (this makes powers of the limb base free)
+   LimbVector base = magnitudeLimbs();
+   int zeroLimbs{0};
+   while (base[zeroLimbs] == 0) {
+      ++zeroLimbs;
+   }
+   base.erase(base.begin(), base.begin() + zeroLimbs);
+   const int baseSize = static_cast<int>(base.size());
+   const long long shift = static_cast<long long>(zeroLimbs) * exponent;
+   const long long capacity = static_cast<long long>(baseSize) * exponent;
+   if (shift + capacity > INT_MAX) {
+      throw std::length_error("InfiniteInt power too large.");
+   }
+
+   /* Left-to-right binary exponentiation: square for every bit below the top
+      one and multiply in the base where the bit is set. Both steps write into
+      the spare buffer and swap, so nothing is allocated inside the loop. */
+   LimbVector power(static_cast<size_t>(capacity));
+   LimbVector spare(static_cast<size_t>(capacity));
+   std::copy(base.begin(), base.end(), power.begin());
+   int size = baseSize;
+   int bit = 31 - __builtin_clz(exponent);
+   while (--bit >= 0) {
+      squareLimbs(power.data(), size, spare.data());
+      size *= 2;
+      while (spare[size - 1] == 0) {
+         --size;
       }
+      power.swap(spare);
 
-      // Add to total result and reset/update variables for next digit of rhs
-      result = add(result, partialResult);
-      carry = 0;
-      ++numZeroes;
+      if (((exponent >> bit) & 1) != 0) {
+         if (baseSize == 1) {
+            spare[size] = multiplyLimbsBySmall(power.data(), size, base[0], spare.data());
+            ++size;
+         } else {
+            multiplyLimbs(power.data(), size, base.data(), baseSize, spare.data());
+            size += baseSize;
+         }
+         while (spare[size - 1] == 0) {
+            --size;
+         }
+         power.swap(spare);
+      }
    }
 
-   // Determine the sign of the result and return it
-   result.isNegative_ = isNegative_ != rhs.isNegative_;
+   power.resize(size);
+   power.insert(power.begin(), static_cast<size_t>(shift), 0);
+   result.assignMagnitude(power, negative);
    return result;
 }
 
-/** add(const InfiniteInt&, const InfiniteInt&)
- * @brief   Helper method to add InfiniteInts. Ignores the sign of both InfiniteInts.
- * @param   rhs   The InfiniteInt to add to this one
- * @post    The returned InfiniteInt represents the sum of the absolute values of
- *          this InfinteInt's number and rhs's.
- * @return  InfiniteInt representing the sum of this InfinteInt's number and rhs's.
+/** gcd(const InfiniteInt&)
+ * @brief   Returns the greatest common divisor of the numbers represented by
+ *          this InfiniteInt and another.
+ * @param   other   The InfiniteInt to take the gcd with
+ * @return  InfiniteInt representing the gcd. It is never negative, and is 0
+ *          only if both numbers are 0.
 */
-InfiniteInt InfiniteInt::add(const InfiniteInt& lhs, const InfiniteInt& rhs) const {
-   InfiniteInt result;        // The result of adding the InfiniteInts
-   result.digits_.clear();     // Remove default 0 digit
-   int partialSum{0};         // The total from summing two digits
-   int carry{0};              // The carry value after summing two digits
-   auto lhsCur = lhs.digits_.last(); // iterator for lhs starting at ones digit
-   auto rhsCur = rhs.digits_.last(); // iterator for rhs starting at ones digit
-
-   // While both IIs have digits, add them one-by-one and record in result
-   while (lhsCur != lhs.digits_.end() && rhsCur != rhs.digits_.end()) {
-      partialSum = *lhsCur + *rhsCur + carry;   // add the digits
-      result.digits_.pushFront(partialSum % 10); // record result
-      carry = partialSum / 10;                  // calculate carry
-
-      // Go to next highest digits (ones digit is at the end so we need to decrement)
-      --lhsCur;
-      --rhsCur;
+InfiniteInt InfiniteInt::gcd(const InfiniteInt& other) const {
+   InfiniteInt result;        // the gcd
+   if (isSmall_ && other.isSmall_) {
+      result.setSmall(static_cast<long long>(binaryGcd(wordMagnitude(small_), wordMagnitude(other.small_))));
+      return result;
    }
+   result.assignMagnitude(gcdLimbs(magnitudeLimbs(), other.magnitudeLimbs(), nullptr), false);
+   return result;
+}
 
-   // While either II still has digits, add them to the result (accounting for carries)
-   while (lhsCur != lhs.digits_.end()) {
-      partialSum = *lhsCur + carry;
-      result.digits_.pushFront(partialSum % 10);
-      carry = partialSum / 10;
-      --lhsCur;
-   }
-   while (rhsCur != rhs.digits_.end()) {
-      partialSum = *rhsCur + carry;
-      result.digits_.pushFront(partialSum % 10);
-      carry = partialSum / 10;
-      --rhsCur;
+/** lcm(const InfiniteInt&)
+ * @brief   Returns the least common multiple of the numbers represented by
+ *          this InfiniteInt and another.
+ * @param   other   The InfiniteInt to take the lcm with
+ * @return  InfiniteInt representing the lcm. It is never negative, and is 0
+ *          if either number is 0.
+*/
+InfiniteInt InfiniteInt::lcm(const InfiniteInt& other) const {
+   InfiniteInt result;        // the lcm
+   if ((isSmall_ && small_ == 0) || (other.isSmall_ && other.small_ == 0)) {
+      return result;
    }
 
-   // Check for a final carry
-   if (carry > 0) {
-      result.digits_.pushFront(carry);
+   // Dividing before multiplying keeps the quotient short
+   result = *this / gcd(other);
+   result *= other;
+   if (result.isNegative_) {
+      result = InfiniteInt(0) - result;
    }
-
    return result;
 }
 
-/** subtract(const InfiniteInt& rhs)
- * @brief   Helper method to subtract InfiniteInts.
- * @param   lhs   The InfiniteInt being subtracted from
- * @param   rhs   InfiniteInt being subtracted from lhs
- * @post    The returned InfiniteInt represents the difference of lhs's
- *          number and rhs's.
- * @return  InfiniteInt representing the difference of lhs's number and
- *          rhs's.
+/** extendedGcd(const InfiniteInt&, InfiniteInt&, InfiniteInt&)
+ * @brief   Returns the greatest common divisor of the numbers represented by
+ *          this InfiniteInt and another, along with Bezout coefficients.
+ * @param   other   The InfiniteInt to take the gcd with
+ * @param   x       Set to the coefficient of this InfiniteInt's number
+ * @param   y       Set to the coefficient of other's number
+ * @pre     x and y are different InfiniteInts (either may be this InfiniteInt or other).
+ * @post    *this * x + other * y equals the gcd. If other is not 0, |x| is at
+ *          most |other| / (2 * gcd); otherwise x is -1, 0 or 1 and y is 0.
+ * @return  InfiniteInt representing the gcd, as given by gcd().
 */
-InfiniteInt InfiniteInt::subtract(const InfiniteInt& lhs, const InfiniteInt& rhs) const {
-   // Need to subtract the smaller absolute value from the larger
-   InfiniteInt result;           // The result of subtracting the two InfiniteInts
-   result.digits_.clear();        // Remove default 0 digit
-   InfiniteInt lhsCopy(lhs);     // copy of lhs that can be changed
-   InfiniteInt rhsCopy(rhs);     // copy of rhs that can be changed
+InfiniteInt InfiniteInt::extendedGcd(const InfiniteInt& other, InfiniteInt& x, InfiniteInt& y) const {
+   // Copy the operands first, since x or y may be one of them
+   const InfiniteInt a(*this);
+   const InfiniteInt b(other);
+   InfiniteInt result;        // the gcd
+   InfiniteInt coefficient;   // a number whose product with |a| is congruent to the gcd modulo b
 
-   // Find largest absolute value and compute the difference
-   lhsCopy.isNegative_ = false;
-   rhsCopy.isNegative_ = false;
-   const InfiniteInt& larger = lhsCopy < rhsCopy ? rhsCopy : lhsCopy;
-   const InfiniteInt& smaller = &larger == &lhsCopy ? rhsCopy : lhsCopy;
+   if (a.isSmall_ && b.isSmall_) {
+      // Both magnitudes are below 2^63, so Euclid's algorithm runs in hardware
+      long long smallCoefficient{0};
+      result.setSmall(extendedWordGcd(static_cast<long long>(wordMagnitude(a.small_)),
+                                      static_cast<long long>(wordMagnitude(b.small_)), smallCoefficient));
+      coefficient.setSmall(smallCoefficient);
+   } else {
+      result.assignMagnitude(gcdLimbs(a.magnitudeLimbs(), b.magnitudeLimbs(), &coefficient), false);
+   }
 
-   int partialDiff{0};        // The total from subtracting two digits
-   int borrow{0};             // The borrow value after subtracting two digits
-   auto largerCur = larger.digits_.last();   // iterator for top InfiniteInt
-   auto smallerCur = smaller.digits_.last(); // iterator for bottom InfiniteInt
+   if (result.isSmall_ && result.small_ == 0) {
+      x = InfiniteInt(0);
+      y = InfiniteInt(0);
+      return result;
+   }
+   if (b.isSmall_ && b.small_ == 0) {
+      x = InfiniteInt(a.isNegative_ ? -1 : 1);
+      y = InfiniteInt(0);
+      return result;
+   }
 
-   // While both IIs have digits, subtract them one-by-one and record in result
-   while (largerCur != larger.digits_.end() && smallerCur != smaller.digits_.end()) {
-      partialDiff = *largerCur - *smallerCur - borrow;   // subtract the digits
+   // The coefficient is only fixed modulo |b| / gcd, so take the one nearest zero
+   InfiniteInt period = b / result;
+   if (period.isNegative_) {
+      period = InfiniteInt(0) - period;
+   }
+   coefficient %= period;
+   InfiniteInt twice = coefficient * 2LL;
+   if (period < twice) {
+      coefficient -= period;
+   } else if (twice < InfiniteInt(0) - period) {
+      coefficient += period;
+   }
+   if (a.isNegative_) {
+      coefficient = InfiniteInt(0) - coefficient;
+   }
 
-      // Check if borrow needed
-      if (partialDiff < 0) {
-         partialDiff += 10;
-         borrow = 1;
-      } else {
-         borrow = 0;
-      }
+   // The gcd minus a * x is an exact multiple of b
+   y = (result - a * coefficient) / b;
+   x = std::move(coefficient);
+   return result;
+}
 
-      // Record result
-      result.digits_.pushFront(partialDiff);
+/** operator+=(const InfiniteInt&)
+ * @brief   Adds the number represented by another InfiniteInt to this one, in place.
+ * @param   rhs   The InfiniteInt to add to this one (may be this InfiniteInt)
+ * @post    This InfiniteInt represents the sum of its old number and rhs's. Its
+ *          limbs have been updated in place, growing only if a carry spills over.
+ * @return  Reference to this InfiniteInt.
+*/
+InfiniteInt& InfiniteInt::operator+=(const InfiniteInt& rhs) {
+   // Use hardware arithmetic while both numbers, and their sum, are inline
+   long long smallSum{0};
+   if (isSmall_ && rhs.isSmall_ && !__builtin_add_overflow(small_, rhs.small_, &smallSum) &&
+       smallSum != LLONG_MIN) {
+      setSmall(smallSum);
+      return *this;
+   }
 
-      // Go to next highest digits (ones digit is at the end so we need to decrement)
-      --largerCur;
-      --smallerCur;
+   // Same sign - the magnitudes add; otherwise rhs's magnitude comes off this one's
+   const bool sameSign = isNegative_ == rhs.isNegative_;
+   spill();
+   if (sameSign) {
+      addMagnitudeInPlace(rhs);
+   } else {
+      subtractMagnitudeInPlace(rhs);
    }
+   normalize();
+   return *this;
+}
 
-   // While lhs still has digits, add them to the result (accounting for borrows)
-   while (largerCur != larger.digits_.end()) {
-      partialDiff = *largerCur - borrow;
-      if (partialDiff < 0) {
-         partialDiff += 10;
-         borrow = 1;
-      } else {
-         borrow = 0;
-      }
-      result.digits_.pushFront(partialDiff);
-      --largerCur;
+/** operator-=(const InfiniteInt&)
+ * @brief   Subtracts the number represented by another InfiniteInt from this one, in place.
+ * @param   rhs   The InfiniteInt to subtract from this one (may be this InfiniteInt)
+ * @post    This InfiniteInt represents the difference of its old number and rhs's.
+ *          Its limbs have been updated in place, growing only if a carry spills over.
+ * @return  Reference to this InfiniteInt.
+*/
+InfiniteInt& InfiniteInt::operator-=(const InfiniteInt& rhs) {
+   // Use hardware arithmetic while both numbers, and their difference, are inline
+   long long smallDiff{0};
+   if (isSmall_ && rhs.isSmall_ && !__builtin_sub_overflow(small_, rhs.small_, &smallDiff) &&
+       smallDiff != LLONG_MIN) {
+      setSmall(smallDiff);
+      return *this;
    }
 
+   // Different signs - the magnitudes add; otherwise rhs's magnitude comes off this one's
+   const bool sameSign = isNegative_ == rhs.isNegative_;
+   spill();
+   if (sameSign) {
+      subtractMagnitudeInPlace(rhs);
+   } else {
+      addMagnitudeInPlace(rhs);
+   }
+   normalize();
+   return *this;
+}
 
-   // Remove any leading zeroes and fix the sign of the result, if necessary
-   result.removeLeadingZeroes();
-   if (result != InfiniteInt(0)) {
-      if ((lhs.isNegative_ && (&larger == &lhsCopy)) ||
-         (!lhs.isNegative_ && (&larger == &rhsCopy))) {
-         result.isNegative_ = true;
-      }
-   }  // Otherwise result should be positive, which it is by default
-   
-   return result;
+/** operator*=(const InfiniteInt&)
+ * @brief   Multiplies this InfiniteInt by the number represented by another.
+ * @param   rhs   The InfiniteInt to multiply this one by (may be this InfiniteInt)
+ * @post    This InfiniteInt represents the product of its old number and rhs's,
+ *          reusing its limb storage where it is large enough.
+ * @return  Reference to this InfiniteInt.
+*/
+InfiniteInt& InfiniteInt::operator*=(const InfiniteInt& rhs) {
+   assignProduct(*this, rhs);
+   return *this;
 }
 
-/** operator==(const InfiniteInt& rhs)
- * @brief   Equality operator. Checks if this InfiniteInt represents the same integer
- *          as another.
- * @param   rhs   The InfiniteInt being compared to.
- * @post    The returned value is true if both InfiniteInts have the same sign and the
- *          same digits in the same order. Otherwise, it is false.
- * @return  True if this InfiniteInt is equal to rhs and false otherwise.
+/** operator/(const InfiniteInt&)
+ * @brief   Divides the number represented by this InfiniteInt by that represented
+ *          by another and returns the quotient, truncated toward zero.
+ * @param   rhs   The InfiniteInt to divide this one by
+ * @pre     rhs does not represent zero.
+ * @post    The returned InfiniteInt represents this InfiniteInt's number divided
+ *          by rhs's, with any fraction discarded.
+ * @return  InfiniteInt representing the truncated quotient.
+ * @throw   std::domain_error if rhs represents zero.
 */
-bool InfiniteInt::operator==(const InfiniteInt& rhs) const {
-   // Check number for difference in number of digits or sign
-   if ((numDigits() != rhs.numDigits()) || (isNegative_ != rhs.isNegative_)) {
-      // Different number of digits or sign - can't be equal
-      return false;
-   }
+InfiniteInt InfiniteInt::operator/(const InfiniteInt& rhs) const {
+   InfiniteInt quotient;      // The quotient of the two InfiniteInts
+   InfiniteInt remainder;     // Computed alongside the quotient, then discarded
+   divmod(rhs, quotient, remainder);
+   return quotient;
+}
 
-   // Check the digits one-by-one, looking for a difference
-   auto lhsCur = digits_.begin();     // iterator for this II
-   auto rhsCur = rhs.digits_.begin(); // iterator for rhs
-   while (lhsCur != digits_.end() && rhsCur != rhs.digits_.end()) {
-      if (*lhsCur != *rhsCur) {
-         // Difference found - not equal
-         return false;
-      }
-      ++lhsCur;
-      ++rhsCur;
-   }
+/** operator%(const InfiniteInt&)
+ * @brief   Returns the remainder of dividing the number represented by this
+ *          InfiniteInt by that represented by another.
+ * @param   rhs   The InfiniteInt to divide this one by
+ * @pre     rhs does not represent zero.
+ * @post    The returned InfiniteInt has the sign of this InfiniteInt's number
+ *          (or is zero) and a magnitude less than rhs's, so that
+ *          (*this / rhs) * rhs + *this % rhs == *this.
+ * @return  InfiniteInt representing the remainder.
+ * @throw   std::domain_error if rhs represents zero.
+*/
+InfiniteInt InfiniteInt::operator%(const InfiniteInt& rhs) const {
+   InfiniteInt quotient;      // Computed alongside the remainder, then discarded
+   InfiniteInt remainder;     // The remainder of dividing the two InfiniteInts
+   divmod(rhs, quotient, remainder);
+   return remainder;
+}
 
-   // No difference found above - must be equal
-   return true;
+/** operator/=(const InfiniteInt&)
+ * @brief   Divides this InfiniteInt by the number represented by another,
+ *          truncating toward zero.
+ * @param   rhs   The InfiniteInt to divide this one by (may be this InfiniteInt)
+ * @pre     rhs does not represent zero.
+ * @post    This InfiniteInt represents the truncated quotient.
+ * @return  Reference to this InfiniteInt.
+ * @throw   std::domain_error if rhs represents zero.
+*/
+InfiniteInt& InfiniteInt::operator/=(const InfiniteInt& rhs) {
+   InfiniteInt remainder;
+   divmod(rhs, *this, remainder);
+   return *this;
 }
 
-/** operator!=(const InfiniteInt& rhs)
- * @brief   Inequality operator. Checks if this InfiniteInt represents the same integer
- *          as another.
- * @param   rhs   The InfiniteInt being compared to.
- * @post    The returned value is false if both InfiniteInts have the same sign and the
- *          same digits in the same order. Otherwise, it is true.
- * @return  False if this InfiniteInt is equal to rhs and true otherwise.
+/** operator%=(const InfiniteInt&)
+ * @brief   Replaces this InfiniteInt with the remainder of dividing it by the
+ *          number represented by another.
+ * @param   rhs   The InfiniteInt to divide this one by (may be this InfiniteInt)
+ * @pre     rhs does not represent zero.
+ * @post    This InfiniteInt represents the remainder, as given by operator%.
+ * @return  Reference to this InfiniteInt.
+ * @throw   std::domain_error if rhs represents zero.
 */
-bool InfiniteInt::operator!=(const InfiniteInt& rhs) const {
-   return !operator==(rhs);
+InfiniteInt& InfiniteInt::operator%=(const InfiniteInt& rhs) {
+   InfiniteInt quotient;
+   divmod(rhs, quotient, *this);
+   return *this;
 }
 
-/** operator<(const InfiniteInt& rhs)
- * @brief   Less-than operator. Checks if the integer this InfiniteInt represents
- *          is less than that of another.
- * @param   rhs   The InfiniteInt being compared to.
- * @post    The returned value is true if this InfiniteInt's integer is less than
- *          rhs's and false otherwise.
- * @return  True if this InfiniteInt is less than rhs and false otherwise.
+/** divmod(const InfiniteInt&, InfiniteInt&, InfiniteInt&)
+ * @brief   Divides the number represented by this InfiniteInt by that represented
+ *          by another, producing the quotient and remainder in a single division.
+ * @param   divisor     The InfiniteInt to divide this one by
+ * @param   quotient    Set to the quotient, truncated toward zero
+ * @param   remainder   Set to the remainder, which has the sign of this InfiniteInt
+ * @pre     divisor does not represent zero, and quotient and remainder are
+ *          different InfiniteInts (either may be this InfiniteInt or divisor).
+ * @post    quotient and remainder hold the same values as *this / divisor and
+ *          *this % divisor.
+ * @throw   std::domain_error if divisor represents zero.
 */
-bool InfiniteInt::operator<(const InfiniteInt& rhs) const {
-   // Check for differences in sign
-   if (!isNegative_ && rhs.isNegative_) {
-      return false;
-   } else if (isNegative_ && !rhs.isNegative_) {
-      return true;
+void InfiniteInt::divmod(const InfiniteInt& divisor, InfiniteInt& quotient, InfiniteInt& remainder) const {
+   if (divisor.isSmall_ && divisor.small_ == 0) {
+      throw std::domain_error("InfiniteInt division by zero.");
    }
 
-   // Check for differences in # of digits (signs are the same)
-   if (numDigits() != rhs.numDigits()) {
-      if (isNegative_) {
-         if (numDigits() > rhs.numDigits()) {
-            return true;
-         } else if (numDigits() < rhs.numDigits()) {
-            return false;
-         }
-      } else if (!isNegative_) {
-         if (numDigits() > rhs.numDigits()) {
-            return false;
-         } else if (numDigits() < rhs.numDigits()) {
-            return true;
-         }
-      }
+   // Use hardware division while both numbers are inline (small_ is never
+   // LLONG_MIN, so the quotient cannot overflow)
+   if (isSmall_ && divisor.isSmall_) {
+      const long long smallQuotient = small_ / divisor.small_;
+      const long long smallRemainder = small_ % divisor.small_;
+      quotient.setSmall(smallQuotient);
+      remainder.setSmall(smallRemainder);
+      return;
    }
 
-   // Same sign and # of digits - check digits one-by-one, starting with highest
-   auto lhsCur = digits_.begin();     // iterator for this II
-   auto rhsCur = rhs.digits_.begin(); // iterator for rhs
-   while (lhsCur != digits_.end() && rhsCur != rhs.digits_.end()) {
-      // Check for lhs < rhs
-      if ((!isNegative_ && (*lhsCur > *rhsCur)) ||
-         (isNegative_ && (*lhsCur < *rhsCur))) {
-         // lhs must be larger
-         return false;
-      }
+   /* Divide the magnitudes as flat limb arrays (read before anything is
+      overwritten, so quotient and remainder may be this InfiniteInt or divisor).
+      Truncation gives the quotient the product's sign and the remainder the
+      dividend's. */
+   const bool quotientNegative = isNegative_ != divisor.isNegative_;
+   const bool remainderNegative = isNegative_;
+   LimbVector numerator = magnitudeLimbs();
+   LimbVector denominator = divisor.magnitudeLimbs();
+   const int numeratorSize = static_cast<int>(numerator.size());
+   const int denominatorSize = static_cast<int>(denominator.size());
+   if (compareLimbs(numerator.data(), numeratorSize, denominator.data(), denominatorSize) < 0) {
+      remainder.assignMagnitude(numerator, remainderNegative);
+      quotient.setSmall(0);
+      return;
+   }
 
-      // Check for rhs > lhs
-      if ((!isNegative_ && (*lhsCur < *rhsCur)) ||
-         (isNegative_ && (*lhsCur > *rhsCur))) {
-         // lhs must be larger
-         return true;
-      }
+   LimbVector quotientLimbs(numeratorSize - denominatorSize + 1);
+   LimbVector remainderLimbs(denominatorSize);
+   divideLimbs(numerator.data(), numeratorSize, denominator.data(), denominatorSize,
+               quotientLimbs.data(), remainderLimbs.data());
+   quotient.assignMagnitude(quotientLimbs, quotientNegative);
+   remainder.assignMagnitude(remainderLimbs, remainderNegative);
+}
 
-      // Same digit - advance to the next
-      ++lhsCur;
-      ++rhsCur;
-   }
+/** operator*(long long)
+ * @brief   Multiplies the number represented by this InfiniteInt by a machine
+ *          integer in a single pass and returns the result as an InfiniteInt.
+ * @param   rhs   The integer to multiply this InfiniteInt by
+ * @post    The returned InfiniteInt represents the product of this InfiniteInt's
+ *          number and rhs.
+ * @return  InfiniteInt representing the product.
+*/
+InfiniteInt InfiniteInt::operator*(long long rhs) const {
+   InfiniteInt result;        // The result of multiplying this InfiniteInt by rhs
+   result.multiplyByWord(*this, rhs);
+   return result;
+}
 
-   // No difference found above - must be equal
-   return false;
+/** operator*(int)
+ * @brief   Multiplies the number represented by this InfiniteInt by an int
+ *          (see operator*(long long)).
+ * @param   rhs   The integer to multiply this InfiniteInt by
+ * @return  InfiniteInt representing the product.
+*/
+InfiniteInt InfiniteInt::operator*(int rhs) const {
+   return *this * static_cast<long long>(rhs);
 }
 
-/** removeLeadingZeroes()
- * @brief   Removes any leading zero digits from this InfiniteInt.
- * @post    All leading zero digits, other than the ones digit, have been removed from this InfiniteInt.
+/** operator*=(long long)
+ * @brief   Multiplies this InfiniteInt by a machine integer in place, in a single pass.
+ * @param   rhs   The integer to multiply this InfiniteInt by
+ * @post    This InfiniteInt represents the product of its old number and rhs.
+ * @return  Reference to this InfiniteInt.
 */
-void InfiniteInt::removeLeadingZeroes() {
-   while ((digits_.numEntries() > 1) && (digits_.front() == 0)) {   // Don't remove the ones digit
-      digits_.popFront();
-   }
+InfiniteInt& InfiniteInt::operator*=(long long rhs) {
+   multiplyByWord(*this, rhs);
+   return *this;
 }
 
-/** operator<<(ostream&, const InfiniteInt&)
- * @brief   Outputs a InfiniteInt to an output stream
- * @param   outStream      The stream to print the queue's entries to
- * @param   IIToPrint      The InfiniteInt whose entries are being printed
- * @pre     outStream is not in an error state when the function is called
- * @post    A textual representation of the number represented by this InfiniteInt
- *          has been output to outStream.
- * @return  Reference to the modified stream.
+/** operator*=(int)
+ * @brief   Multiplies this InfiniteInt by an int in place (see operator*=(long long)).
+ * @param   rhs   The integer to multiply this InfiniteInt by
+ * @return  Reference to this InfiniteInt.
 */
-std::ostream& operator<<(std::ostream& outStream, const InfiniteInt& IIToPrint) {
-   // Output minus sign, if necessary
-   if (IIToPrint.isNegative_) {
-      outStream << '-';
-   }
+InfiniteInt& InfiniteInt::operator*=(int rhs) {
+   return *this *= static_cast<long long>(rhs);
+}
 
-   // Output the digits, from highest to lowest
-   for (auto iter = IIToPrint.digits_.begin(); iter != IIToPrint.digits_.end(); ++iter) {
-      outStream << *iter;
-   }
+/** operator/(long long)
+ * @brief   Divides the number represented by this InfiniteInt by a machine
+ *          integer in a single pass and returns the quotient, truncated toward zero.
+ * @param   rhs   The integer to divide this InfiniteInt by
+ * @pre     rhs is not 0.
+ * @post    The returned InfiniteInt is the same as *this / InfiniteInt(rhs).
+ * @return  InfiniteInt representing the truncated quotient.
+ * @throw   std::domain_error if rhs is 0.
+*/
+InfiniteInt InfiniteInt::operator/(long long rhs) const {
+   InfiniteInt quotient;      // The quotient of this InfiniteInt and rhs
+   quotient.divideByWord(*this, rhs);
+   return quotient;
+}
 
-   // Return stream
-   return outStream;
+/** operator/(int)
+ * @brief   Divides the number represented by this InfiniteInt by an int
+ *          (see operator/(long long)).
+ * @param   rhs   The integer to divide this InfiniteInt by
+ * @return  InfiniteInt representing the truncated quotient.
+ * @throw   std::domain_error if rhs is 0.
+*/
+InfiniteInt InfiniteInt::operator/(int rhs) const {
+   return *this / static_cast<long long>(rhs);
+}
+
+/** operator/=(long long)
+ * @brief   Divides this InfiniteInt by a machine integer in place, in a single
+ *          pass, truncating toward zero.
+ * @param   rhs   The integer to divide this InfiniteInt by
+ * @pre     rhs is not 0.
+ * @post    This InfiniteInt represents the truncated quotient.
+ * @return  Reference to this InfiniteInt.
+ * @throw   std::domain_error if rhs is 0.
+*/
+InfiniteInt& InfiniteInt::operator/=(long long rhs) {
+   divideByWord(*this, rhs);
+   return *this;
+}
+
+/** operator/=(int)
+ * @brief   Divides this InfiniteInt by an int in place (see operator/=(long long)).
+ * @param   rhs   The integer to divide this InfiniteInt by
+ * @return  Reference to this InfiniteInt.
+ * @throw   std::domain_error if rhs is 0.
+*/
+InfiniteInt& InfiniteInt::operator/=(int rhs) {
+   return *this /= static_cast<long long>(rhs);
+}
+
+/** operator%(long long)
+ * @brief   Returns the remainder of dividing the number represented by this
+ *          InfiniteInt by a machine integer, found in a single pass without
+ *          building the quotient.
+ * @param   rhs   The integer to divide this InfiniteInt by
+ * @pre     rhs is not 0.
+ * @post    The returned InfiniteInt is the same as *this % InfiniteInt(rhs).
+ * @return  InfiniteInt representing the remainder.
+ * @throw   std::domain_error if rhs is 0.
+*/
+InfiniteInt InfiniteInt::operator%(long long rhs) const {
+   InfiniteInt remainder;     // The remainder of dividing this InfiniteInt by rhs
+   remainder.setSmall(remainderByWord(rhs));
+   return remainder;
+}
+
+/** operator%(int)
+ * @brief   Returns the remainder of dividing the number represented by this
+ *          InfiniteInt by an int (see operator%(long long)).
+ * @param   rhs   The integer to divide this InfiniteInt by
+ * @return  InfiniteInt representing the remainder.
+ * @throw   std::domain_error if rhs is 0.
+*/
+InfiniteInt InfiniteInt::operator%(int rhs) const {
+   return *this % static_cast<long long>(rhs);
+}
+
+/** operator%=(long long)
+ * @brief   Replaces this InfiniteInt with the remainder of dividing it by a
+ *          machine integer (see operator%(long long)).
+ * @param   rhs   The integer to divide this InfiniteInt by
+ * @pre     rhs is not 0.
+ * @post    This InfiniteInt represents the remainder.
+ * @return  Reference to this InfiniteInt.
+ * @throw   std::domain_error if rhs is 0.
+*/
+InfiniteInt& InfiniteInt::operator%=(long long rhs) {
+   setSmall(remainderByWord(rhs));
+   return *this;
+}
+
+/** operator%=(int)
+ * @brief   Replaces this InfiniteInt with the remainder of dividing it by an int
+ *          (see operator%=(long long)).
+ * @param   rhs   The integer to divide this InfiniteInt by
+ * @return  Reference to this InfiniteInt.
+ * @throw   std::domain_error if rhs is 0.
+*/
+InfiniteInt& InfiniteInt::operator%=(int rhs) {
+   return *this %= static_cast<long long>(rhs);
+}
+
+/** multiplyByWord(const InfiniteInt&, long long)
+ * @brief   Sets this InfiniteInt to the product of another and a machine integer.
+ * @param   lhs      The InfiniteInt factor (may be this InfiniteInt)
+ * @param   factor   The integer factor
+ * @post    This InfiniteInt represents the product of lhs's number and factor.
+*/
+void InfiniteInt::multiplyByWord(const InfiniteInt& lhs, long long factor) {
+   // Use hardware arithmetic while lhs, and the product, are inline
+   long long smallProduct{0};
+   if (lhs.isSmall_ && !__builtin_mul_overflow(lhs.small_, factor, &smallProduct) &&
+       smallProduct != LLONG_MIN) {
+      setSmall(smallProduct);
+      return;
+   }
+   if (factor == 0) {
+      setSmall(0);
+      return;
+   }
+
+   // Each limb times the factor, plus the carry, must fit in 64 bits
+   const unsigned long long magnitude = wordMagnitude(factor);
+   if (magnitude > UINT32_MAX) {
+      assignProduct(lhs, InfiniteInt(factor));
+      return;
+   }
+   const bool negative = lhs.isNegative_ != (factor < 0);
+
+   // Multiply limbs from the lowest up, in place if lhs is this InfiniteInt
+   unsigned long long carry{0};
+   if (&lhs == this && !isSmall_) {
+      for (auto iter = digits_.last(); iter != digits_.end(); --iter) {
+         unsigned long long product = limbValue(*iter) * magnitude + carry;
+         *iter = limbEntry(product % kLimbBase);
+         carry = product / kLimbBase;
+      }
+   } else if (lhs.isSmall_) {
+      Limb lhsLimbs[3];
+      const int lhsSize = lhs.smallLimbs(lhsLimbs);
+      clearLimbs(lhsSize + 2);
+      for (int i = 0; i < lhsSize; ++i) {
+         unsigned long long product = lhsLimbs[i] * magnitude + carry;
+         digits_.pushFront(limbEntry(product % kLimbBase));
+         carry = product / kLimbBase;
+      }
+   } else {
+      clearLimbs(lhs.digits_.numEntries() + 2);
+      for (auto iter = lhs.digits_.last(); iter != lhs.digits_.end(); --iter) {
+         unsigned long long product = limbValue(*iter) * magnitude + carry;
+         digits_.pushFront(limbEntry(product % kLimbBase));
+         carry = product / kLimbBase;
+      }
+   }
+   while (carry != 0) {
+      digits_.pushFront(limbEntry(carry % kLimbBase));
+      carry /= kLimbBase;
+   }
+   isNegative_ = negative;
+   normalize();
+}
+
+/** divideByWord(const InfiniteInt&, long long)
+ * @brief   Sets this InfiniteInt to the quotient of another and a machine integer.
+ * @param   lhs      The dividend (may be this InfiniteInt)
+ * @param   divisor  The integer divisor
+ * @post    This InfiniteInt represents lhs's number divided by divisor,
+ *          truncated toward zero.
+ * @return  The remainder, which has the sign of lhs's number.
+ * @throw   std::domain_error if divisor is 0.
+*/
+long long InfiniteInt::divideByWord(const InfiniteInt& lhs, long long divisor) {
+   if (divisor == 0) {
+      throw std::domain_error("InfiniteInt division by zero.");
+   }
+
+   // Use hardware division while lhs is inline (small_ is never LLONG_MIN, so
+   // the quotient cannot overflow)
+   if (lhs.isSmall_) {
+      const long long smallRemainder = lhs.small_ % divisor;
+      setSmall(lhs.small_ / divisor);
+      return smallRemainder;
+   }
+
+   // Each partial dividend, the remainder so far and the next limb, must fit in 64 bits
+   const unsigned long long magnitude = wordMagnitude(divisor);
+   if (magnitude > UINT32_MAX) {
+      InfiniteInt remainder;
+      lhs.divmod(InfiniteInt(divisor), *this, remainder);
+      return remainder.small_;
+   }
+   const bool lhsNegative = lhs.isNegative_;
+   const bool negative = lhsNegative != (divisor < 0);
+
+   // Divide limbs from the highest down, in place if lhs is this InfiniteInt
+   unsigned long long partialRemainder{0};
+   if (&lhs == this) {
+      for (auto iter = digits_.begin(); iter != digits_.end(); ++iter) {
+         unsigned long long partialDividend = partialRemainder * kLimbBase + limbValue(*iter);
+         *iter = limbEntry(partialDividend / magnitude);
+         partialRemainder = partialDividend % magnitude;
+      }
+   } else {
+      clearLimbs(lhs.digits_.numEntries());
+      for (auto iter = lhs.digits_.begin(); iter != lhs.digits_.end(); ++iter) {
+         unsigned long long partialDividend = partialRemainder * kLimbBase + limbValue(*iter);
+         digits_.pushBack(limbEntry(partialDividend / magnitude));
+         partialRemainder = partialDividend % magnitude;
+      }
+   }
+   removeLeadingZeroes();
+   isNegative_ = negative;
+   normalize();
+
+   const long long remainder = static_cast<long long>(partialRemainder);
+   return lhsNegative ? -remainder : remainder;
+}
+
+/** remainderByWord(long long)
+ * @brief   Finds the remainder of dividing this InfiniteInt by a machine integer.
+ * @param   divisor  The integer divisor
+ * @return  The remainder, which has the sign of this InfiniteInt's number.
+ * @throw   std::domain_error if divisor is 0.
+*/
+long long InfiniteInt::remainderByWord(long long divisor) const {
+   if (divisor == 0) {
+      throw std::domain_error("InfiniteInt division by zero.");
+   }
+   if (isSmall_) {
+      return small_ % divisor;
+   }
+
+   // Each partial dividend, the remainder so far and the next limb, must fit in 64 bits
+   const unsigned long long magnitude = wordMagnitude(divisor);
+   if (magnitude > UINT32_MAX) {
+      return (*this % InfiniteInt(divisor)).small_;
+   }
+
+   unsigned long long partialRemainder{0};
+   for (auto iter = digits_.begin(); iter != digits_.end(); ++iter) {
+      partialRemainder = (partialRemainder * kLimbBase + limbValue(*iter)) % magnitude;
+   }
+   const long long remainder = static_cast<long long>(partialRemainder);
+   return isNegative_ ? -remainder : remainder;
+}
+
+/** wordMagnitude(long long)
+ * @brief   Returns the magnitude of a long long, which is exact even for LLONG_MIN.
+ * @param   value    The number whose magnitude is returned
+ * @return  The magnitude of value.
+*/
+unsigned long long InfiniteInt::wordMagnitude(long long value) {
+   return value < 0 ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+}
+
+/** assignWord(unsigned __int128, bool)
+ * @brief   Sets this InfiniteInt to a signed machine integer of up to 128 bits,
+ *          inline if it fits and otherwise straight into limbs.
+ * @param   magnitude   The magnitude of the number
+ * @param   negative    True if the number is negative
+ * @post    This InfiniteInt is normalized and represents the number.
+*/
+void InfiniteInt::assignWord(unsigned __int128 magnitude, bool negative) {
+   if (magnitude <= static_cast<unsigned long long>(LLONG_MAX)) {
+      const long long value = static_cast<long long>(magnitude);
+      setSmall(negative ? -value : value);
+      return;
+   }
+
+   // 128 bits fit in five decimal limbs (four binary ones); write them lowest first
+   clearLimbs(5);
+   for (; magnitude != 0; magnitude /= kLimbBase) {
+      digits_.pushFront(limbEntry(static_cast<unsigned long long>(magnitude % kLimbBase)));
+   }
+   isNegative_ = negative;
+}
+
+/** limbMagnitude(unsigned long long&)
+ * @brief   Reads the magnitude of a number held in limbs into a machine word.
+ * @param   magnitude   Set to the magnitude, if it fits
+ * @pre     This InfiniteInt is held in limbs.
+ * @return  True if the magnitude is at most ULLONG_MAX and false otherwise.
+*/
+bool InfiniteInt::limbMagnitude(unsigned long long& magnitude) const {
+   // A word holds at most three decimal limbs (two binary ones), so longer numbers fail at once
+   if (digits_.numEntries() > 3) {
+      return false;
+   }
+
+   // Fold in the limbs from the highest down, stopping at the first overflow
+   unsigned long long total{0};
+   for (auto cur = digits_.begin(); cur != digits_.end(); ++cur) {
+      if (__builtin_mul_overflow(total, kLimbBase, &total) ||
+          __builtin_add_overflow(total, limbValue(*cur), &total)) {
+         return false;
+      }
+   }
+   magnitude = total;
+   return true;
+}
+
+/** assignProduct(const InfiniteInt&, const InfiniteInt&)
+ * @brief   Sets this InfiniteInt to the product of two others.
+ * @param   lhs   First factor (may be this InfiniteInt)
+ * @param   rhs   Second factor (may be this InfiniteInt)
+ * @post    This InfiniteInt represents the product of lhs's number and rhs's.
+*/
+void InfiniteInt::assignProduct(const InfiniteInt& lhs, const InfiniteInt& rhs) {
+   if (&lhs == &rhs) {
+      assignSquare(lhs);
+      return;
+   }
+
+   // Use hardware arithmetic while both numbers, and their product, are inline
+   // (this also covers either InfiniteInt being zero, since zero is always inline)
+   long long smallProduct{0};
+   if (lhs.isSmall_ && rhs.isSmall_ && !__builtin_mul_overflow(lhs.small_, rhs.small_, &smallProduct) &&
+       smallProduct != LLONG_MIN) {
+      setSmall(smallProduct);
+      return;
+   }
+   if ((lhs.isSmall_ && lhs.small_ == 0) || (rhs.isSmall_ && rhs.small_ == 0)) {
+      setSmall(0);
+      return;
+   }
+
+   // Multiply the magnitudes as flat limb arrays (read before anything is
+   // overwritten, so lhs and rhs may be this InfiniteInt), then set the sign
+   const bool negative = lhs.isNegative_ != rhs.isNegative_;
+   LimbVector lhsLimbs = lhs.magnitudeLimbs();
+   LimbVector rhsLimbs = rhs.magnitudeLimbs();
+   LimbVector product(lhsLimbs.size() + rhsLimbs.size());
+   multiplyLimbs(lhsLimbs.data(), static_cast<int>(lhsLimbs.size()),
+                 rhsLimbs.data(), static_cast<int>(rhsLimbs.size()), product.data());
+   assignMagnitude(product, negative);
+}
+
+/** assignSquare(const InfiniteInt&)
+ * @brief   Sets this InfiniteInt to the square of another.
+ * @param   source   The InfiniteInt to square (may be this InfiniteInt)
+ * @post    This InfiniteInt represents the square of source's number.
+*/
+void InfiniteInt::assignSquare(const InfiniteInt& source) {
+   // Use hardware arithmetic while the number, and its square, are inline
+   long long smallSquare{0};
+   if (source.isSmall_ && !__builtin_mul_overflow(source.small_, source.small_, &smallSquare)) {
+      setSmall(smallSquare);
+      return;
+   }
+
+   LimbVector limbs = source.magnitudeLimbs();
+   LimbVector product(2 * limbs.size());
+   squareLimbs(limbs.data(), static_cast<int>(limbs.size()), product.data());
+   assignMagnitude(product, false);
+}
+
+/** smallLimbs(Limb*)
+ * @brief   Splits the magnitude of an inline number into limbs.
+ * @param   limbs    Array to write the limbs to, lowest first
+ * @pre     This InfiniteInt is inline and limbs has room for 3 limbs.
+ * @return  The number of limbs written (at least 1).
+*/
+int InfiniteInt::smallLimbs(Limb* limbs) const {
+   // small_ is never LLONG_MIN, so its magnitude can be taken directly
+   unsigned long long magnitude = static_cast<unsigned long long>(isNegative_ ? -small_ : small_);
+   int count{0};
+   do {
+      limbs[count++] = static_cast<Limb>(magnitude % kLimbBase);
+      magnitude /= kLimbBase;
+   } while (magnitude != 0);
+   return count;
+}
+
+/** addMagnitudeInPlace(const InfiniteInt&)
+ * @brief   Adds the magnitude of another InfiniteInt to this one's, in place.
+ * @param   rhs   The InfiniteInt whose magnitude is added (may be this InfiniteInt)
+ * @pre     This InfiniteInt is held in limbs.
+ * @post    This InfiniteInt's magnitude is the sum of its old magnitude and rhs's;
+ *          its sign is unchanged. Limbs above rhs's highest are only touched while
+ *          a carry is still moving up.
+*/
+void InfiniteInt::addMagnitudeInPlace(const InfiniteInt& rhs) {
+   Limb rhsSmall[3];       // rhs's limbs, if it is inline
+   const int rhsSmallSize = rhs.isSmall_ ? rhs.smallLimbs(rhsSmall) : 0;
+   int rhsSmallIndex{0};
+   auto rhsCur = rhs.digits_.last();
+
+   // Reads rhs's limbs from lowest to highest, whichever form it is in
+   auto nextRhsLimb = [&](unsigned long long& limb) {
+      if (rhs.isSmall_) {
+         if (rhsSmallIndex == rhsSmallSize) {
+            return false;
+         }
+         limb = rhsSmall[rhsSmallIndex++];
+         return true;
+      }
+      if (rhsCur == rhs.digits_.end()) {
+         return false;
+      }
+      limb = limbValue(*rhsCur);
+      --rhsCur;
+      return true;
+   };
+
+   // Add limbs from the lowest up, stopping once rhs is used up and nothing is carried
+   unsigned long long carry{0};
+   unsigned long long rhsLimb{0};
+   bool rhsLeft = nextRhsLimb(rhsLimb);
+   for (auto cur = digits_.last(); cur != digits_.end() && (rhsLeft || carry != 0); --cur) {
+      unsigned long long partialSum = limbValue(*cur) + carry + (rhsLeft ? rhsLimb : 0);
+      carry = partialSum >= kLimbBase ? 1 : 0;
+      *cur = limbEntry(partialSum - carry * kLimbBase);
+      rhsLeft = rhsLeft && nextRhsLimb(rhsLimb);
+   }
+
+   // Extend at the high end with whatever is left of rhs and the carry
+   while (rhsLeft || carry != 0) {
+      unsigned long long partialSum = carry + (rhsLeft ? rhsLimb : 0);
+      carry = partialSum >= kLimbBase ? 1 : 0;
+      digits_.pushFront(limbEntry(partialSum - carry * kLimbBase));
+      rhsLeft = rhsLeft && nextRhsLimb(rhsLimb);
+   }
+}
+
+/** subtractMagnitudeInPlace(const InfiniteInt&)
+ * @brief   Subtracts the magnitude of another InfiniteInt from this one's, in place.
+ * @param   rhs   The InfiniteInt whose magnitude is subtracted (may be this InfiniteInt)
+ * @pre     This InfiniteInt is held in limbs.
+ * @post    This InfiniteInt's magnitude is the absolute difference of its old
+ *          magnitude and rhs's. Its sign has been flipped if rhs's magnitude
+ *          was the larger, and leading zero limbs have been removed.
+*/
+void InfiniteInt::subtractMagnitudeInPlace(const InfiniteInt& rhs) {
+   Limb rhsSmall[3];       // rhs's limbs, if it is inline
+   const int rhsSmallSize = rhs.isSmall_ ? rhs.smallLimbs(rhsSmall) : 0;
+   int rhsSmallIndex{0};
+   auto rhsCur = rhs.digits_.last();
+
+   // Make room for every limb of rhs (rhs cannot be this InfiniteInt if it is longer)
+   const int rhsSize = rhs.isSmall_ ? rhsSmallSize : rhs.digits_.numEntries();
+   while (digits_.numEntries() < rhsSize) {
+      digits_.pushFront(0);
+   }
+
+   // Subtract limbs from the lowest up, stopping once rhs is used up and nothing is borrowed
+   unsigned long long borrow{0};
+   for (auto cur = digits_.last(); cur != digits_.end(); --cur) {
+      unsigned long long subtrahend = borrow;
+      if (rhs.isSmall_ && rhsSmallIndex < rhsSmallSize) {
+         subtrahend += rhsSmall[rhsSmallIndex++];
+      } else if (!rhs.isSmall_ && rhsCur != rhs.digits_.end()) {
+         subtrahend += limbValue(*rhsCur);
+         --rhsCur;
+      } else if (borrow == 0) {
+         break;
+      }
+
+      unsigned long long limb = limbValue(*cur);
+      borrow = limb < subtrahend ? 1 : 0;
+      *cur = limbEntry(limb + borrow * kLimbBase - subtrahend);
+   }
+
+   /* A borrow out of the highest limb means rhs was larger, leaving
+      kLimbBase^n - (rhs - this). Negate that to get the difference. */
+   if (borrow != 0) {
+      borrow = 0;
+      for (auto cur = digits_.last(); cur != digits_.end(); --cur) {
+         unsigned long long subtrahend = limbValue(*cur) + borrow;
+         borrow = subtrahend > 0 ? 1 : 0;
+         *cur = limbEntry(borrow * kLimbBase - subtrahend);
+      }
+      isNegative_ = !isNegative_;
+   }
+   removeLeadingZeroes();
+}
+
+/** add(const InfiniteInt&, const InfiniteInt&)
+ * @brief   Helper method to add InfiniteInts. Ignores the sign of both InfiniteInts.
+ * @param   rhs   The InfiniteInt to add to this one
+ * @post    The returned InfiniteInt represents the sum of the absolute values of
+ *          this InfinteInt's number and rhs's.
+ * @return  InfiniteInt representing the sum of this InfinteInt's number and rhs's.
+*/
+InfiniteInt InfiniteInt::add(const InfiniteInt& lhs, const InfiniteInt& rhs) const {
+   InfiniteInt result;        // The result of adding the InfiniteInts
+   result.clearLimbs(std::max(lhs.digits_.numEntries(), rhs.digits_.numEntries()) + 1);
+   unsigned long long partialSum{0}; // The total from summing two limbs
+   unsigned long long carry{0};      // The carry value after summing two limbs
+   auto lhsCur = lhs.digits_.last(); // iterator for lhs starting at the lowest limb
+   auto rhsCur = rhs.digits_.last(); // iterator for rhs starting at the lowest limb
+
+   // While both IIs have limbs, add them one-by-one and record in result
+   while (lhsCur != lhs.digits_.end() && rhsCur != rhs.digits_.end()) {
+      partialSum = limbValue(*lhsCur) + limbValue(*rhsCur) + carry;  // add the limbs
+      carry = partialSum >= kLimbBase ? 1 : 0;                        // calculate carry
+      result.digits_.pushFront(limbEntry(partialSum - carry * kLimbBase)); // record result
+
+      // Go to next highest limbs (lowest limb is at the end so we need to decrement)
+      --lhsCur;
+      --rhsCur;
+   }
+
+   // While either II still has limbs, add them to the result (accounting for carries)
+   while (lhsCur != lhs.digits_.end()) {
+      partialSum = limbValue(*lhsCur) + carry;
+      carry = partialSum >= kLimbBase ? 1 : 0;
+      result.digits_.pushFront(limbEntry(partialSum - carry * kLimbBase));
+      --lhsCur;
+   }
+   while (rhsCur != rhs.digits_.end()) {
+      partialSum = limbValue(*rhsCur) + carry;
+      carry = partialSum >= kLimbBase ? 1 : 0;
+      result.digits_.pushFront(limbEntry(partialSum - carry * kLimbBase));
+      --rhsCur;
+   }
+
+   // Check for a final carry
+   if (carry > 0) {
+      result.digits_.pushFront(limbEntry(carry));
+   }
+
+   return result;
+}
+
+/** subtract(const InfiniteInt& rhs)
+ * @brief   Helper method to subtract InfiniteInts.
+ * @param   lhs   The InfiniteInt being subtracted from
+ * @param   rhs   InfiniteInt being subtracted from lhs
+ * @post    The returned InfiniteInt represents the difference of lhs's
+ *          number and rhs's.
+ * @return  InfiniteInt representing the difference of lhs's number and
+ *          rhs's.
+*/
+InfiniteInt InfiniteInt::subtract(const InfiniteInt& lhs, const InfiniteInt& rhs) const {
+   // Need to subtract the smaller absolute value from the larger
+   InfiniteInt result;           // The result of subtracting the two InfiniteInts
+   const int order = lhs.compareMagnitude(rhs);
+   if (order == 0) {
+      result.setSmall(0);
+      return result;
+   }
+
+   // Find largest absolute value and compute the difference
+   const InfiniteInt& larger = order > 0 ? lhs : rhs;
+   const InfiniteInt& smaller = order > 0 ? rhs : lhs;
+   result.clearLimbs(larger.digits_.numEntries());
+
+   long long partialDiff{0};  // The total from subtracting two limbs
+   long long borrow{0};       // The borrow value after subtracting two limbs
+   auto largerCur = larger.digits_.last();   // iterator for top InfiniteInt
+   auto smallerCur = smaller.digits_.last(); // iterator for bottom InfiniteInt
+
+   // While both IIs have limbs, subtract them one-by-one and record in result
+   while (smallerCur != smaller.digits_.end()) {
+      partialDiff = static_cast<long long>(limbValue(*largerCur)) -
+                    static_cast<long long>(limbValue(*smallerCur)) - borrow; // subtract the limbs
+
+      // Check if borrow needed
+      if (partialDiff < 0) {
+         partialDiff += static_cast<long long>(kLimbBase);
+         borrow = 1;
+      } else {
+         borrow = 0;
+      }
+
+      // Record result
+      result.digits_.pushFront(limbEntry(partialDiff));
+
+      // Go to next highest limbs (lowest limb is at the end so we need to decrement)
+      --largerCur;
+      --smallerCur;
+   }
+
+   // While the larger still has limbs, add them to the result (accounting for borrows)
+   while (largerCur != larger.digits_.end()) {
+      partialDiff = static_cast<long long>(limbValue(*largerCur)) - borrow;
+      if (partialDiff < 0) {
+         partialDiff += static_cast<long long>(kLimbBase);
+         borrow = 1;
+      } else {
+         borrow = 0;
+      }
+      result.digits_.pushFront(limbEntry(partialDiff));
+      --largerCur;
+   }
+
+   /* Remove any leading zeroes. The magnitudes differ, so the result is nonzero
+      and negative exactly when lhs is negative and the larger, or positive and
+      the smaller. */
+   result.removeLeadingZeroes();
+   result.isNegative_ = (order > 0) == lhs.isNegative_;
+   return result;
+}
+
+/** compareMagnitude(const InfiniteInt&)
+ * @brief   Compares the absolute values of this InfiniteInt and another, in place.
+ * @param   rhs   The InfiniteInt being compared to
+ * @pre     Both InfiniteInts are normalized, or both are held in limbs.
+ * @return  A negative value if |this| < |rhs|, 0 if they are equal, and a
+ *          positive value if |this| > |rhs|.
+*/
+int InfiniteInt::compareMagnitude(const InfiniteInt& rhs) const {
+   // Inline numbers are smaller in magnitude than any number held in limbs
+   if (isSmall_ && rhs.isSmall_) {
+      const unsigned long long lhsMagnitude = wordMagnitude(small_);
+      const unsigned long long rhsMagnitude = wordMagnitude(rhs.small_);
+      return lhsMagnitude < rhsMagnitude ? -1 : (lhsMagnitude > rhsMagnitude ? 1 : 0);
+   } else if (isSmall_) {
+      return -1;
+   } else if (rhs.isSmall_) {
+      return 1;
+   }
+
+   // Neither has leading zero limbs, so the longer is larger
+   const int lhsSize = digits_.numEntries();
+   const int rhsSize = rhs.digits_.numEntries();
+   if (lhsSize != rhsSize) {
+      return lhsSize < rhsSize ? -1 : 1;
+   }
+
+   // Same # of limbs - check limbs one-by-one, starting with highest
+   auto rhsCur = rhs.digits_.begin();
+   for (auto lhsCur = digits_.begin(); lhsCur != digits_.end(); ++lhsCur, ++rhsCur) {
+      if (*lhsCur != *rhsCur) {
+         return limbValue(*lhsCur) < limbValue(*rhsCur) ? -1 : 1;
+      }
+   }
+   return 0;
+}
+
+/** setKaratsubaThreshold(int)
+ * @brief   Sets the operand size from which operator* switches from
+ *          schoolbook multiplication to Karatsuba.
+ * @param   limbs    The new threshold, in limbs
+ * @pre     No other thread is multiplying InfiniteInts.
+ * @post    Products whose smaller operand has at least limbs limbs are split
+ *          with Karatsuba; smaller products use schoolbook multiplication.
+ * @throw   std::invalid_argument if limbs is less than 4 (smaller operands
+ *          cannot be split into strictly smaller products).
+*/
+void InfiniteInt::setKaratsubaThreshold(int limbs) {
+   if (limbs < 4) {
+      throw std::invalid_argument("Karatsuba threshold must be at least 4 limbs.");
+   }
+   karatsubaThreshold_ = limbs;
+}
+
+/** karatsubaThreshold()
+ * @brief   Returns the operand size from which operator* uses Karatsuba.
+ * @return  The current threshold, in limbs.
+*/
+int InfiniteInt::karatsubaThreshold() {
+   return karatsubaThreshold_;
+}
+
+/** setToom3Threshold(int)
+ * @brief   Sets the operand size from which operator* multiplies operands of
+ *          similar size with Toom-3 instead of Karatsuba.
+ * @param   limbs    The new threshold, in limbs
+ * @pre     No other thread is multiplying InfiniteInts.
+ * @post    Balanced products whose smaller operand has at least limbs limbs
+ *          (and at least karatsubaThreshold() limbs) are split with Toom-3.
+ * @throw   std::invalid_argument if limbs is less than 4.
+*/
+void InfiniteInt::setToom3Threshold(int limbs) {
+   if (limbs < 4) {
+      throw std::invalid_argument("Toom-3 threshold must be at least 4 limbs.");
+   }
+   toom3Threshold_ = limbs;
+}
+
+/** toom3Threshold()
+ * @brief   Returns the operand size from which operator* uses Toom-3.
+ * @return  The current threshold, in limbs.
+*/
+int InfiniteInt::toom3Threshold() {
+   return toom3Threshold_;
+}
+
+/** setUnbalancedToomThreshold(int)
+ * @brief   Sets the operand size from which operator* multiplies operands of
+ *          different sizes with Toom-2.5 or Toom-4.2.
+ * @param   limbs    The new threshold, in limbs
+ * @pre     No other thread is multiplying InfiniteInts.
+ * @post    Products whose longer operand is 1.25 to 2.5 times the length of
+ *          the shorter one, and whose shorter operand has at least limbs limbs
+ *          (and at least karatsubaThreshold() limbs), use Toom-2.5 (below 1.75
+ *          times) or Toom-4.2.
+ * @throw   std::invalid_argument if limbs is less than 4.
+*/
+void InfiniteInt::setUnbalancedToomThreshold(int limbs) {
+   if (limbs < 4) {
+      throw std::invalid_argument("Unbalanced Toom threshold must be at least 4 limbs.");
+   }
+   unbalancedToomThreshold_ = limbs;
+}
+
+/** unbalancedToomThreshold()
+ * @brief   Returns the operand size from which operator* uses Toom-2.5 and Toom-4.2.
+ * @return  The current threshold, in limbs.
+*/
+int InfiniteInt::unbalancedToomThreshold() {
+   return unbalancedToomThreshold_;
+}
+
+/** setNttThreshold(int)
+ * @brief   Sets the operand size from which operator* multiplies with number
+ *          theoretic transforms.
+ * @param   limbs    The new threshold, in limbs
+ * @pre     No other thread is multiplying InfiniteInts.
+ * @post    Products whose smaller operand has at least limbs limbs (and at least
+ *          karatsubaThreshold() limbs) use NTT multiplication, as long as the
+ *          product has at most kMaxNttLength limbs.
+ * @throw   std::invalid_argument if limbs is less than 1.
+*/
+void InfiniteInt::setNttThreshold(int limbs) {
+   if (limbs < 1) {
+      throw std::invalid_argument("NTT threshold must be at least 1 limb.");
+   }
+   nttThreshold_ = limbs;
+}
+
+/** nttThreshold()
+ * @brief   Returns the operand size from which operator* uses NTT multiplication.
+ * @return  The current threshold, in limbs.
+*/
+int InfiniteInt::nttThreshold() {
+   return nttThreshold_;
+}
+
+/** setBurnikelZieglerThreshold(int)
+ * @brief   Sets the divisor size from which division switches from long
+ *          division to recursive Burnikel-Ziegler division.
+ * @param   limbs    The new threshold, in limbs
+ * @pre     No other thread is dividing InfiniteInts.
+ * @post    Divisions whose divisor and quotient both have at least limbs limbs
+ *          use Burnikel-Ziegler (or Newton) division, which also long divides
+ *          the pieces that its recursion splits below limbs.
+ * @throw   std::invalid_argument if limbs is less than 2.
+*/
+void InfiniteInt::setBurnikelZieglerThreshold(int limbs) {
+   if (limbs < 2) {
+      throw std::invalid_argument("Burnikel-Ziegler threshold must be at least 2 limbs.");
+   }
+   burnikelZieglerThreshold_ = limbs;
+}
+
+/** burnikelZieglerThreshold()
+ * @brief   Returns the divisor size from which division uses Burnikel-Ziegler.
+ * @return  The current threshold, in limbs.
+*/
+int InfiniteInt::burnikelZieglerThreshold() {
+   return burnikelZieglerThreshold_;
+}
+
+/** setNewtonDivisionThreshold(int)
+ * @brief   Sets the divisor size from which division multiplies by a reciprocal
+ *          found with Newton's method.
+ * @param   limbs    The new threshold, in limbs
+ * @pre     No other thread is dividing InfiniteInts.
+ * @post    Divisions whose divisor has at least limbs limbs (and which would
+ *          otherwise use Burnikel-Ziegler) use Newton division.
+ * @throw   std::invalid_argument if limbs is less than 2.
+*/
+void InfiniteInt::setNewtonDivisionThreshold(int limbs) {
+   if (limbs < 2) {
+      throw std::invalid_argument("Newton division threshold must be at least 2 limbs.");
+   }
+   newtonDivisionThreshold_ = limbs;
+}
+
+/** newtonDivisionThreshold()
+ * @brief   Returns the divisor size from which division uses Newton's method.
+ * @return  The current threshold, in limbs.
+*/
+int InfiniteInt::newtonDivisionThreshold() {
+   return newtonDivisionThreshold_;
+}
+
+/** setHalfGcdThreshold(int)
+ * @brief   Sets the operand size from which gcd() and extendedGcd() shorten
+ *          their operands with half-GCD before running Lehmer's algorithm.
+ * @param   limbs    The new threshold, in limbs
+ * @pre     No other thread is taking gcds of InfiniteInts.
+ * @post    Gcds of numbers with at least limbs limbs (and the half-GCD steps
+ *          within them) are split recursively; shorter ones use Lehmer steps.
+ * @throw   std::invalid_argument if limbs is less than 4.
+*/
+void InfiniteInt::setHalfGcdThreshold(int limbs) {
+   if (limbs < 4) {
+      throw std::invalid_argument("Half-GCD threshold must be at least 4 limbs.");
+   }
+   halfGcdThreshold_ = limbs;
+}
+
+/** halfGcdThreshold()
+ * @brief   Returns the operand size from which gcds use half-GCD.
+ * @return  The current threshold, in limbs.
+*/
+int InfiniteInt::halfGcdThreshold() {
+   return halfGcdThreshold_;
+}
+
+/** operator==(const InfiniteInt& rhs)
+ * @brief   Equality operator. Checks if this InfiniteInt represents the same integer
+ *          as another.
+ * @param   rhs   The InfiniteInt being compared to.
+ * @post    The returned value is true if both InfiniteInts have the same sign and the
+ *          same digits in the same order. Otherwise, it is false.
+ * @return  True if this InfiniteInt is equal to rhs and false otherwise.
+*/
+bool InfiniteInt::operator==(const InfiniteInt& rhs) const {
+   return compare(rhs) == 0;
+}
+
+/** operator!=(const InfiniteInt& rhs)
+ * @brief   Inequality operator. Checks if this InfiniteInt represents the same integer
+ *          as another.
+ * @param   rhs   The InfiniteInt being compared to.
+ * @post    The returned value is false if both InfiniteInts have the same sign and the
+ *          same digits in the same order. Otherwise, it is true.
+ * @return  False if this InfiniteInt is equal to rhs and true otherwise.
+*/
+bool InfiniteInt::operator!=(const InfiniteInt& rhs) const {
+   return compare(rhs) != 0;
+}
+
+/** operator<(const InfiniteInt& rhs)
+ * @brief   Less-than operator. Checks if the integer this InfiniteInt represents
+ *          is less than that of another.
+ * @param   rhs   The InfiniteInt being compared to.
+ * @post    The returned value is true if this InfiniteInt's integer is less than
+ *          rhs's and false otherwise.
+ * @return  True if this InfiniteInt is less than rhs and false otherwise.
+*/
+bool InfiniteInt::operator<(const InfiniteInt& rhs) const {
+   return compare(rhs) < 0;
+}
+
+/** operator<=(const InfiniteInt& rhs)
+ * @brief   Less-than-or-equal operator.
+ * @param   rhs   The InfiniteInt being compared to.
+ * @return  True if this InfiniteInt is less than or equal to rhs and false otherwise.
+*/
+bool InfiniteInt::operator<=(const InfiniteInt& rhs) const {
+   return compare(rhs) <= 0;
+}
+
+/** operator>(const InfiniteInt& rhs)
+ * @brief   Greater-than operator.
+ * @param   rhs   The InfiniteInt being compared to.
+ * @return  True if this InfiniteInt is greater than rhs and false otherwise.
+*/
+bool InfiniteInt::operator>(const InfiniteInt& rhs) const {
+   return compare(rhs) > 0;
+}
+
+/** operator>=(const InfiniteInt& rhs)
+ * @brief   Greater-than-or-equal operator.
+ * @param   rhs   The InfiniteInt being compared to.
+ * @return  True if this InfiniteInt is greater than or equal to rhs and false otherwise.
+*/
+bool InfiniteInt::operator>=(const InfiniteInt& rhs) const {
+   return compare(rhs) >= 0;
+}
+
+/** compare(const InfiniteInt& rhs)
+ * @brief   Three-way comparison of the integers two InfiniteInts represent.
+ * @param   rhs   The InfiniteInt being compared to.
+ * @return  -1 if this InfiniteInt is less than rhs, 0 if they are equal and 1 if
+ *          it is greater.
+*/
+int InfiniteInt::compare(const InfiniteInt& rhs) const {
+   // Differing signs settle it; otherwise the magnitudes decide, reversed for negatives
+   if (isNegative_ != rhs.isNegative_) {
+      return isNegative_ ? -1 : 1;
+   }
+   const int order = compareMagnitude(rhs);
+   return isNegative_ ? -order : order;
+}
+
+/** setSmall(long long)
+ * @brief   Stores a number inline, releasing any limbs.
+ * @param   value    The number to store
+ * @pre     value is not LLONG_MIN.
+ * @post    This InfiniteInt represents value in its inline form.
+*/
+void InfiniteInt::setSmall(long long value) {
+   digits_.clear();
+   isNegative_ = value < 0;
+   isSmall_ = true;
+   small_ = value;
+}
+
+/** clearLimbs(int)
+ * @brief   Switches this InfiniteInt to empty limb storage, for a kernel to fill.
+ * @param   capacity The number of limbs to reserve room for
+ * @post    This InfiniteInt has no limbs, is not negative and is not inline.
+*/
+void InfiniteInt::clearLimbs(int capacity) {
+   digits_.clear();
+   digits_.reserve(capacity);
+   isNegative_ = false;
+   isSmall_ = false;
+   small_ = 0;
+}
+
+/** spill()
+ * @brief   Moves an inline number into limb storage.
+ * @post    This InfiniteInt represents the same number, held in digits_.
+*/
+void InfiniteInt::spill() {
+   if (!isSmall_) {
+      return;
+   }
+
+   // small_ is never LLONG_MIN, so its magnitude can be taken directly
+   unsigned long long magnitude = static_cast<unsigned long long>(isNegative_ ? -small_ : small_);
+   bool negative = isNegative_;
+   clearLimbs(3);
+   isNegative_ = negative;
+
+   // Push limbs one by one to the list of limbs, lowest first.
+   // Using a do/while guarantees 0 will be handled correctly.
+   do {
+      digits_.pushFront(limbEntry(magnitude % kLimbBase));
+      magnitude /= kLimbBase;
+   } while (magnitude != 0);
+}
+
+/** spilled(InfiniteInt&)
+ * @brief   Gives this InfiniteInt's number in limb storage, copying only if
+ *          it is currently inline.
+ * @param   scratch  InfiniteInt that receives the limbs when a copy is needed
+ * @return  Reference to *this if its number is already in limbs, otherwise
+ *          to scratch.
+*/
+const InfiniteInt& InfiniteInt::spilled(InfiniteInt& scratch) const {
+   if (!isSmall_) {
+      return *this;
+   }
+   scratch.setSmall(small_);
+   scratch.spill();
+   return scratch;
+}
+
+/** normalize()
+ * @brief   Moves a number held in limbs back inline if it fits.
+ * @pre     digits_ has no leading zero limbs.
+ * @post    isSmall_ is true exactly when the number is in [-LLONG_MAX, LLONG_MAX].
+*/
+void InfiniteInt::normalize() {
+   // A long long holds at most 3 decimal limbs (or 2 binary ones), so longer numbers stay put
+   if (isSmall_ || (digits_.numEntries() > 3)) {
+      return;
+   }
+
+   unsigned long long magnitude{0};   // The magnitude of the number, built highest limb first
+   for (auto iter = digits_.begin(); iter != digits_.end(); ++iter) {
+      if (__builtin_mul_overflow(magnitude, kLimbBase, &magnitude) ||
+          __builtin_add_overflow(magnitude, limbValue(*iter), &magnitude)) {
+         return;
+      }
+   }
+   if (magnitude > static_cast<unsigned long long>(LLONG_MAX)) {
+      return;
+   }
+
+   long long value = static_cast<long long>(magnitude);
+   setSmall(isNegative_ ? -value : value);
+}
+
+/** magnitudeLimbs()
+ * @brief   Copies the magnitude of this InfiniteInt into a flat limb array.
+ * @return  The limbs of this InfiniteInt's magnitude, ordered from lowest to highest.
+*/
+InfiniteInt::LimbVector InfiniteInt::magnitudeLimbs() const {
+   LimbVector limbs;
+   if (isSmall_) {
+      // small_ is never LLONG_MIN, so its magnitude can be taken directly
+      unsigned long long magnitude = static_cast<unsigned long long>(isNegative_ ? -small_ : small_);
+      do {
+         limbs.push_back(static_cast<Limb>(magnitude % kLimbBase));
+         magnitude /= kLimbBase;
+      } while (magnitude != 0);
+      return limbs;
+   }
+
+   limbs.reserve(digits_.numEntries());
+   for (auto iter = digits_.last(); iter != digits_.end(); --iter) {
+      limbs.push_back(static_cast<Limb>(limbValue(*iter)));
+   }
+   return limbs;
+}
+
+/** assignMagnitude(const LimbVector&, bool)
+ * @brief   Sets this InfiniteInt from a flat limb array and a sign.
+ * @param   limbs       The magnitude, ordered from lowest limb to highest (may
+ *                      have leading zero limbs)
+ * @param   negative    Whether the number is negative (ignored for zero)
+ * @post    This InfiniteInt represents the given number, inline if it fits.
+*/
+void InfiniteInt::assignMagnitude(const LimbVector& limbs, bool negative) {
+   // Skip leading zero limbs
+   int size = static_cast<int>(limbs.size());
+   while (size > 0 && limbs[size - 1] == 0) {
+      --size;
+   }
+   if (size == 0) {
+      setSmall(0);
+      return;
+   }
+
+   clearLimbs(size);
+   for (int i = size - 1; i >= 0; --i) {
+      digits_.pushBack(limbEntry(limbs[i]));
+   }
+   isNegative_ = negative;
+   normalize();
+}
+
+/** addLimbs(const Limb*, int, const Limb*, int, Limb*)
+ * @brief   Adds two limb arrays.
+ * @param   lhs      First addend, ordered from lowest limb to highest
+ * @param   lhsSize  # of limbs in lhs
+ * @param   rhs      Second addend, ordered from lowest limb to highest
+ * @param   rhsSize  # of limbs in rhs
+ * @param   sum      Array to write the lowest lhsSize limbs of the sum to
+ * @pre     lhsSize >= rhsSize and sum has room for lhsSize limbs.
+ * @return  The carry out of the highest limb (0 or 1).
+*/
+InfiniteInt::Limb InfiniteInt::addLimbs(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* sum) {
+   unsigned long long carry{0};
+   for (int i = 0; i < lhsSize; ++i) {
+      unsigned long long partialSum = lhs[i] + carry + (i < rhsSize ? rhs[i] : 0);
+      carry = partialSum >= kLimbBase ? 1 : 0;
+      sum[i] = static_cast<Limb>(partialSum - carry * kLimbBase);
+   }
+   return static_cast<Limb>(carry);
+}
+
+/** addLimbsInPlace(Limb*, int, const Limb*, int)
+ * @brief   Adds one limb array into another, carrying as far as needed.
+ * @param   lhs      The array being added to, ordered from lowest limb to highest
+ * @param   lhsSize  # of limbs in lhs
+ * @param   rhs      The array being added, ordered from lowest limb to highest
+ * @param   rhsSize  # of limbs in rhs
+ * @pre     lhsSize >= rhsSize and the sum fits in lhsSize limbs.
+ * @post    lhs holds the sum.
+*/
+void InfiniteInt::addLimbsInPlace(Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize) {
+   unsigned long long carry{0};
+   for (int i = 0; i < lhsSize && (i < rhsSize || carry != 0); ++i) {
+      unsigned long long partialSum = lhs[i] + carry + (i < rhsSize ? rhs[i] : 0);
+      carry = partialSum >= kLimbBase ? 1 : 0;
+      lhs[i] = static_cast<Limb>(partialSum - carry * kLimbBase);
+   }
+}
+
+/** subtractLimbsInPlace(Limb*, int, const Limb*, int)
+ * @brief   Subtracts one limb array from another, borrowing as far as needed.
+ * @param   lhs      The array being subtracted from, ordered from lowest limb to highest
+ * @param   lhsSize  # of limbs in lhs
+ * @param   rhs      The array being subtracted, ordered from lowest limb to highest
+ * @param   rhsSize  # of limbs in rhs
+ * @pre     lhsSize >= rhsSize and lhs's number is at least rhs's.
+ * @post    lhs holds the difference.
+*/
+void InfiniteInt::subtractLimbsInPlace(Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize) {
+   unsigned long long borrow{0};
+   for (int i = 0; i < lhsSize && (i < rhsSize || borrow != 0); ++i) {
+      unsigned long long subtrahend = borrow + (i < rhsSize ? rhs[i] : 0);
+      if (lhs[i] >= subtrahend) {
+         lhs[i] = static_cast<Limb>(lhs[i] - subtrahend);
+         borrow = 0;
+      } else {
+         lhs[i] = static_cast<Limb>(lhs[i] + kLimbBase - subtrahend);
+         borrow = 1;
+      }
+   }
+}
+
+/** multiplyLimbs(const Limb*, int, const Limb*, int, Limb*)
+ * @brief   Multiplies two limb arrays, choosing the algorithm by operand size.
+ * @param   lhs      First factor, ordered from lowest limb to highest
+ * @param   lhsSize  # of limbs in lhs (at least 1)
+ * @param   rhs      Second factor, ordered from lowest limb to highest
+ * @param   rhsSize  # of limbs in rhs (at least 1)
+ * @param   product  Array to write the product to
+ * @pre     product has room for lhsSize + rhsSize limbs and does not overlap
+ *          lhs or rhs.
+ * @post    All lhsSize + rhsSize limbs of product have been written.
+*/
+void InfiniteInt::multiplyLimbs(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product) {
+   if (lhs == rhs && lhsSize == rhsSize) {
+      squareLimbs(lhs, lhsSize, product);
+      return;
+   }
+
+   // Keep the longer operand on the left
+   if (lhsSize < rhsSize) {
+      std::swap(lhs, rhs);
+      std::swap(lhsSize, rhsSize);
+   }
+
+   if (rhsSize < karatsubaThreshold_) {
+      schoolbookMultiply(lhs, lhsSize, rhs, rhsSize, product);
+   } else if (rhsSize >= nttThreshold_ && lhsSize + rhsSize <= kMaxNttLength) {
+      nttMultiply(lhs, lhsSize, rhs, rhsSize, product);
+   } else if (2 * lhsSize >= 5 * rhsSize) {
+      multiplyInPieces(lhs, lhsSize, rhs, rhsSize, product);
+   } else if (rhsSize >= unbalancedToomThreshold_ && 4 * lhsSize >= 7 * rhsSize) {
+      toomMultiply(lhs, lhsSize, 4, rhs, rhsSize, 2, product);   // Toom-4.2
+   } else if (rhsSize >= unbalancedToomThreshold_ && 4 * lhsSize >= 5 * rhsSize) {
+      toomMultiply(lhs, lhsSize, 3, rhs, rhsSize, 2, product);   // Toom-2.5
+   } else if (rhsSize >= toom3Threshold_) {
+      toomMultiply(lhs, lhsSize, 3, rhs, rhsSize, 3, product);   // Toom-3
+   } else {
+      karatsubaMultiply(lhs, lhsSize, rhs, rhsSize, product);
+   }
+}
+
+/** multiplyInPieces(const Limb*, int, const Limb*, int, Limb*)
+ * @brief   Multiplies a long limb array by a much shorter one, one piece of the
+ *          long array (as long as the short one) at a time.
+ * @pre     As for multiplyLimbs, and lhsSize >= rhsSize.
+ * @post    All lhsSize + rhsSize limbs of product have been written.
+*/
+void InfiniteInt::multiplyInPieces(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product) {
+   const int productSize = lhsSize + rhsSize;
+   std::fill(product, product + productSize, 0);
+
+   // Each piece product is balanced, so it can use the fast algorithms
+   LimbVector piece(2 * rhsSize);
+   for (int start = 0; start < lhsSize; start += rhsSize) {
+      int pieceSize = std::min(rhsSize, lhsSize - start);
+      multiplyLimbs(lhs + start, pieceSize, rhs, rhsSize, piece.data());
+      addLimbsInPlace(product + start, productSize - start, piece.data(), pieceSize + rhsSize);
+   }
+}
+
+/** squareLimbs(const Limb*, int, Limb*)
+ * @brief   Squares a limb array, choosing the algorithm by operand size.
+ * @param   limbs    The number to square, ordered from lowest limb to highest
+ * @param   size     # of limbs in limbs (at least 1)
+ * @param   product  Array to write the square to
+ * @pre     product has room for 2 * size limbs and does not overlap limbs.
+ * @post    All 2 * size limbs of product have been written.
+*/
+void InfiniteInt::squareLimbs(const Limb* limbs, int size, Limb* product) {
+   /* Schoolbook squaring forms half the limb products, so it stays ahead of
+      Karatsuba up to about twice the multiplication threshold. NTT and Toom-3
+      notice that both operands are the same and evaluate them once. */
+   if (size < 2 * karatsubaThreshold_) {
+      schoolbookSquare(limbs, size, product);
+   } else if (size >= nttThreshold_ && 2 * size <= kMaxNttLength) {
+      nttMultiply(limbs, size, limbs, size, product);
+   } else if (size >= toom3Threshold_) {
+      toomMultiply(limbs, size, 3, limbs, size, 3, product);
+   } else {
+      karatsubaSquare(limbs, size, product);
+   }
+}
+
+/** schoolbookSquare(const Limb*, int, Limb*)
+ * @brief   Squares a limb array by forming each product of two different limbs
+ *          once, doubling them and adding the squares of the limbs.
+ * @param   limbs    The number to square, ordered from lowest limb to highest
+ * @param   size     # of limbs in limbs
+ * @param   product  Array to write the square to
+ * @pre     As for squareLimbs.
+ * @post    All 2 * size limbs of product have been written.
+*/
+void InfiniteInt::schoolbookSquare(const Limb* limbs, int size, Limb* product) {
+   const int productSize = 2 * size;
+
+   // Sum limbs[i] * limbs[j] for i < j into product, which is half of the cross terms
+   if (kDeferredRows < 2) {
+      // No headroom - carry as each row is added, straight into the product
+      std::fill(product, product + productSize, 0);
+      for (int i = 0; i < size; ++i) {
+         unsigned long long limb = limbs[i];
+         unsigned long long carry{0};
+         for (int j = i + 1; j < size; ++j) {
+            unsigned long long current = product[i + j] + limbs[j] * limb + carry;
+            product[i + j] = static_cast<Limb>(current % kLimbBase);
+            carry = current / kLimbBase;
+         }
+         product[i + size] = static_cast<Limb>(carry);
+      }
+   } else {
+      // Small squares accumulate on the stack; larger ones get one heap buffer
+      const int kStackColumns = 64;
+      unsigned long long stackColumns[kStackColumns];
+      std::vector<unsigned long long> heapColumns;
+      unsigned long long* columns = stackColumns;
+      if (productSize > kStackColumns) {
+         heapColumns.resize(productSize);
+         columns = heapColumns.data();
+      }
+      std::fill(columns, columns + productSize, 0);
+
+      for (int rowStart = 0; rowStart < size; rowStart += kDeferredRows) {
+         const int rowEnd = std::min(size, rowStart + kDeferredRows);
+         for (int i = rowStart; i < rowEnd; ++i) {
+            const unsigned long long limb = limbs[i];
+            unsigned long long* row = columns + i;
+            for (int j = i + 1; j < size; ++j) {
+               row[j] += limbs[j] * limb;
+            }
+         }
+
+         unsigned long long carry{0};
+         for (int column = 2 * rowStart + 1; column < rowEnd + size || carry != 0; ++column) {
+            unsigned long long current = columns[column] + carry;
+            columns[column] = current % kLimbBase;
+            carry = current / kLimbBase;
+         }
+      }
+
+      for (int column = 0; column < productSize; ++column) {
+         product[column] = static_cast<Limb>(columns[column]);
+      }
+   }
+
+   // Double the cross terms and add each limb's square, split over its two columns
+   unsigned long long carry{0};
+   for (int column = 0; column < productSize; ++column) {
+      const unsigned long long diagonal = static_cast<unsigned long long>(limbs[column / 2]) * limbs[column / 2];
+      unsigned long long current = 2ULL * product[column] + carry +
+                                   (column % 2 == 0 ? diagonal % kLimbBase : diagonal / kLimbBase);
+      product[column] = static_cast<Limb>(current % kLimbBase);
+      carry = current / kLimbBase;
+   }
+}
+
+/** karatsubaSquare(const Limb*, int, Limb*)
+ * @brief   Squares a limb array by splitting it in half and using three
+ *          half-sized squares.
+ * @param   limbs    The number to square, ordered from lowest limb to highest
+ * @param   size     # of limbs in limbs
+ * @param   product  Array to write the square to
+ * @pre     As for squareLimbs, and size >= 4.
+ * @post    All 2 * size limbs of product have been written.
+*/
+void InfiniteInt::karatsubaSquare(const Limb* limbs, int size, Limb* product) {
+   const int productSize = 2 * size;
+   const int half = (size + 1) / 2;   // # of limbs in the low half
+
+   // With limbs = high * B^half + low, the squares of the halves go straight
+   // into their places in product
+   squareLimbs(limbs, half, product);
+   squareLimbs(limbs + half, size - half, product + 2 * half);
+
+   // (low + high)^2 - low^2 - high^2 is the middle term, 2 * low * high
+   LimbVector sum(half + 1);
+   sum[half] = addLimbs(limbs, half, limbs + half, size - half, sum.data());
+   LimbVector middle(2 * half + 2);
+   squareLimbs(sum.data(), half + 1, middle.data());
+   subtractLimbsInPlace(middle.data(), 2 * half + 2, product, 2 * half);
+   subtractLimbsInPlace(middle.data(), 2 * half + 2, product + 2 * half, productSize - 2 * half);
+
+   // Add the middle term in at B^half (its leading limbs are zero wherever the square ends)
+   int middleSize = 2 * half + 2;
+   while (middleSize > 0 && middle[middleSize - 1] == 0) {
+      --middleSize;
+   }
+   addLimbsInPlace(product + half, productSize - half, middle.data(), middleSize);
+}
+
+/** schoolbookMultiply(const Limb*, int, const Limb*, int, Limb*)
+ * @brief   Multiplies two limb arrays one row at a time, accumulating every row
+ *          into a single buffer of 64-bit columns and normalizing carries only
+ *          once the columns run out of headroom.
+ * @param   lhs      First factor, ordered from lowest limb to highest
+ * @param   lhsSize  # of limbs in lhs
+ * @param   rhs      Second factor, ordered from lowest limb to highest
+ * @param   rhsSize  # of limbs in rhs
+ * @param   product  Array to write the product to
+ * @pre     product has room for lhsSize + rhsSize limbs and does not overlap
+ *          lhs or rhs.
+ * @post    All lhsSize + rhsSize limbs of product have been written.
+*/
+void InfiniteInt::schoolbookMultiply(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product) {
+   const int productSize = lhsSize + rhsSize;
+
+   // Columns can only defer carries if they have room for at least two rows
+   if (kDeferredRows < 2) {
+      // No headroom - carry as each row is added, straight into the product
+      std::fill(product, product + productSize, 0);
+      for (int i = 0; i < rhsSize; ++i) {
+         unsigned long long rhsLimb = rhs[i];
+         unsigned long long carry{0};
+         if (rhsLimb == 0) {
+            continue;
+         }
+         for (int j = 0; j < lhsSize; ++j) {
+            // (kLimbBase - 1)^2 + 2 * (kLimbBase - 1) still fits in 64 bits
+            unsigned long long current = product[i + j] + lhs[j] * rhsLimb + carry;
+            product[i + j] = static_cast<Limb>(current % kLimbBase);
+            carry = current / kLimbBase;
+         }
+         product[i + lhsSize] = static_cast<Limb>(carry);
+      }
+      return;
+   }
+
+   // Small products accumulate on the stack; larger ones get one heap buffer
+   const int kStackColumns = 64;
+   unsigned long long stackColumns[kStackColumns];
+   std::vector<unsigned long long> heapColumns;
+   unsigned long long* columns = stackColumns;
+   if (productSize > kStackColumns) {
+      heapColumns.resize(productSize);
+      columns = heapColumns.data();
+   }
+   std::fill(columns, columns + productSize, 0);
+
+   for (int rowStart = 0; rowStart < rhsSize; rowStart += kDeferredRows) {
+      const int rowEnd = std::min(rhsSize, rowStart + kDeferredRows);
+
+      // Add lhs times each limb of rhs into the columns, shifted to that limb's position
+      for (int i = rowStart; i < rowEnd; ++i) {
+         const unsigned long long rhsLimb = rhs[i];
+         unsigned long long* row = columns + i;
+         for (int j = 0; j < lhsSize; ++j) {
+            row[j] += lhs[j] * rhsLimb;
+         }
+      }
+
+      // Bring every column these rows touched back below kLimbBase, carrying upwards
+      unsigned long long carry{0};
+      for (int column = rowStart; column < rowEnd + lhsSize || carry != 0; ++column) {
+         unsigned long long current = columns[column] + carry;
+         columns[column] = current % kLimbBase;
+         carry = current / kLimbBase;
+      }
+   }
+
+   for (int column = 0; column < productSize; ++column) {
+      product[column] = static_cast<Limb>(columns[column]);
+   }
+}
+
+/** karatsubaMultiply(const Limb*, int, const Limb*, int, Limb*)
+ * @brief   Multiplies two limb arrays by splitting each in half and using three
+ *          half-sized products instead of four.
+ * @param   lhs      First factor, ordered from lowest limb to highest
+ * @param   lhsSize  # of limbs in lhs
+ * @param   rhs      Second factor, ordered from lowest limb to highest
+ * @param   rhsSize  # of limbs in rhs
+ * @param   product  Array to write the product to
+ * @pre     lhsSize >= rhsSize >= 4, product has room for lhsSize + rhsSize limbs
+ *          and does not overlap lhs or rhs.
+ * @post    All lhsSize + rhsSize limbs of product have been written.
+*/
+void InfiniteInt::karatsubaMultiply(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product) {
+   const int productSize = lhsSize + rhsSize;
+   const int half = (lhsSize + 1) / 2;   // # of limbs in the low half of each operand
+
+   if (rhsSize <= half) {
+      // Too unbalanced to split both operands - multiply rhs by rhs-sized pieces of lhs instead
+      multiplyInPieces(lhs, lhsSize, rhs, rhsSize, product);
+      return;
+   }
+
+   // With lhs = lhsHigh * B^half + lhsLow and rhs likewise, the low and high
+   // products go straight into their places in product
+   multiplyLimbs(lhs, half, rhs, half, product);
+   multiplyLimbs(lhs + half, lhsSize - half, rhs + half, rhsSize - half, product + 2 * half);
+
+   // (lhsLow + lhsHigh) * (rhsLow + rhsHigh) - low - high is the middle product
+   LimbVector lhsSum(half + 1);
+   LimbVector rhsSum(half + 1);
+   lhsSum[half] = addLimbs(lhs, half, lhs + half, lhsSize - half, lhsSum.data());
+   rhsSum[half] = addLimbs(rhs, half, rhs + half, rhsSize - half, rhsSum.data());
+   LimbVector middle(2 * half + 2);
+   multiplyLimbs(lhsSum.data(), half + 1, rhsSum.data(), half + 1, middle.data());
+   subtractLimbsInPlace(middle.data(), 2 * half + 2, product, 2 * half);
+   subtractLimbsInPlace(middle.data(), 2 * half + 2, product + 2 * half, productSize - 2 * half);
+
+   // Add the middle product in at B^half (its leading limbs are zero wherever the product ends)
+   int middleSize = 2 * half + 2;
+   while (middleSize > 0 && middle[middleSize - 1] == 0) {
+      --middleSize;
+   }
+   addLimbsInPlace(product + half, productSize - half, middle.data(), middleSize);
+}
+
+/** SignedLimbs
+ * @brief   A signed number held as a flat limb array, for the intermediate
+ *          values of Toom multiplication (which can go negative).
+*/
+struct InfiniteInt::SignedLimbs {
+   LimbVector magnitude;   // ordered from lowest limb to highest, with no leading zero limbs
+   bool negative;          // true if the number is negative (never true for zero)
+
+   /** SignedLimbs(const Limb*, int)
+    * @brief   Constructs the non-negative number held in a limb array.
+    * @param   limbs    The limbs, ordered from lowest to highest
+    * @param   size     # of limbs (may be 0, for zero)
+   */
+   SignedLimbs(const Limb* limbs, int size) : magnitude(limbs, limbs + size), negative(false) {
+      trim();
+   }
+
+   /** trim()
+    * @brief   Removes leading zero limbs, making zero non-negative.
+   */
+   void trim() {
+      while (!magnitude.empty() && magnitude.back() == 0) {
+         magnitude.pop_back();
+      }
+      if (magnitude.empty()) {
+         negative = false;
+      }
+   }
+
+   /** add(const SignedLimbs&, bool)
+    * @brief   Adds (or subtracts) another signed number to this one.
+    * @param   rhs         The number to add
+    * @param   subtract    Subtract rhs instead of adding it
+    * @post    This holds the sum (or difference).
+   */
+   void add(const SignedLimbs& rhs, bool subtract = false) {
+      const bool rhsNegative = rhs.negative != subtract;
+      const int rhsSize = static_cast<int>(rhs.magnitude.size());
+
+      if (negative == rhsNegative) {
+         // Same sign - add the magnitudes
+         magnitude.resize(std::max(static_cast<int>(magnitude.size()), rhsSize) + 1, 0);
+         addLimbsInPlace(magnitude.data(), static_cast<int>(magnitude.size()), rhs.magnitude.data(), rhsSize);
+      } else if (compareLimbs(magnitude.data(), static_cast<int>(magnitude.size()),
+                              rhs.magnitude.data(), rhsSize) >= 0) {
+         // Different signs, this magnitude larger - it keeps its sign
+         subtractLimbsInPlace(magnitude.data(), static_cast<int>(magnitude.size()), rhs.magnitude.data(), rhsSize);
+      } else {
+         // Different signs, rhs magnitude larger - the result takes rhs's sign
+         LimbVector difference(rhs.magnitude);
+         subtractLimbsInPlace(difference.data(), rhsSize, magnitude.data(), static_cast<int>(magnitude.size()));
+         magnitude.swap(difference);
+         negative = rhsNegative;
+      }
+      trim();
+   }
+
+   /** multiplyBySmall(Limb)
+    * @brief   Multiplies this number by a single limb.
+    * @param   factor   The limb to multiply by
+   */
+   void multiplyBySmall(Limb factor) {
+      unsigned long long carry{0};
+      for (Limb& limb : magnitude) {
+         unsigned long long current = limb * static_cast<unsigned long long>(factor) + carry;
+         limb = static_cast<Limb>(current % kLimbBase);
+         carry = current / kLimbBase;
+      }
+      if (carry != 0) {
+         magnitude.push_back(static_cast<Limb>(carry));
+      }
+      trim();
+   }
+
+   /** divideExactlyBySmall(Limb)
+    * @brief   Divides this number by a single limb that is known to divide it.
+    * @param   divisor  The limb to divide by (not 0)
+   */
+   void divideExactlyBySmall(Limb divisor) {
+      unsigned long long remainder{0};
+      for (int i = static_cast<int>(magnitude.size()) - 1; i >= 0; --i) {
+         unsigned long long current = remainder * kLimbBase + magnitude[i];
+         magnitude[i] = static_cast<Limb>(current / divisor);
+         remainder = current % divisor;
+      }
+      trim();
+   }
+
+   /** shiftUp(int)
+    * @brief   Multiplies this number by kLimbBase^limbs.
+    * @param   limbs    # of zero limbs to add at the bottom
+   */
+   void shiftUp(int limbs) {
+      if (!magnitude.empty()) {
+         magnitude.insert(magnitude.begin(), limbs, 0);
+      }
+   }
+
+   /** shiftDown(int)
+    * @brief   Divides this number by kLimbBase^limbs, truncating toward zero.
+    * @param   limbs    # of limbs to drop from the bottom
+   */
+   void shiftDown(int limbs) {
+      magnitude.erase(magnitude.begin(), magnitude.begin() + std::min(static_cast<int>(magnitude.size()), limbs));
+      trim();
+   }
+
+   /** multiply(const SignedLimbs&, const SignedLimbs&)
+    * @brief   Multiplies two signed numbers with the fastest suitable algorithm.
+    * @return  The product.
+   */
+   static SignedLimbs multiply(const SignedLimbs& lhs, const SignedLimbs& rhs) {
+      SignedLimbs product(nullptr, 0);
+      if (lhs.magnitude.empty() || rhs.magnitude.empty()) {
+         return product;
+      }
+      product.magnitude.resize(lhs.magnitude.size() + rhs.magnitude.size());
+      multiplyLimbs(lhs.magnitude.data(), static_cast<int>(lhs.magnitude.size()),
+                    rhs.magnitude.data(), static_cast<int>(rhs.magnitude.size()), product.magnitude.data());
+      product.negative = lhs.negative != rhs.negative;
+      product.trim();
+      return product;
+   }
+};
+
+/** compareLimbs(const Limb*, int, const Limb*, int)
+ * @brief   Compares the numbers held in two limb arrays.
+ * @param   lhs      First number, ordered from lowest limb to highest
+ * @param   lhsSize  # of limbs in lhs
+ * @param   rhs      Second number, ordered from lowest limb to highest
+ * @param   rhsSize  # of limbs in rhs
+ * @return  A negative value if lhs < rhs, 0 if they are equal, and a positive
+ *          value if lhs > rhs.
+*/
+int InfiniteInt::compareLimbs(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize) {
+   // Leading zero limbs do not count
+   while (lhsSize > 0 && lhs[lhsSize - 1] == 0) {
+      --lhsSize;
+   }
+   while (rhsSize > 0 && rhs[rhsSize - 1] == 0) {
+      --rhsSize;
+   }
+   if (lhsSize != rhsSize) {
+      return lhsSize < rhsSize ? -1 : 1;
+   }
+
+   // Same # of limbs - check limbs one-by-one, starting with highest
+   for (int i = lhsSize - 1; i >= 0; --i) {
+      if (lhs[i] != rhs[i]) {
+         return lhs[i] < rhs[i] ? -1 : 1;
+      }
+   }
+   return 0;
+}
+
+/** divideLimbs(const Limb*, int, const Limb*, int, Limb*, Limb*)
+ * @brief   Divides one limb array by another, choosing the algorithm by operand size.
+ * @param   numerator        Dividend, ordered from lowest limb to highest
+ * @param   numeratorSize    # of limbs in numerator
+ * @param   denominator      Divisor, ordered from lowest limb to highest
+ * @param   denominatorSize  # of limbs in denominator
+ * @param   quotient         Array to write the quotient to
+ * @param   remainder        Array to write the remainder to
+ * @pre     numeratorSize >= denominatorSize >= 1, the highest limb of denominator
+ *          is not 0, quotient has room for numeratorSize - denominatorSize + 1
+ *          limbs and remainder has room for denominatorSize limbs.
+ * @post    All limbs of quotient and remainder have been written.
+*/
+void InfiniteInt::divideLimbs(const Limb* numerator, int numeratorSize, const Limb* denominator,
+                              int denominatorSize, Limb* quotient, Limb* remainder) {
+   // Long division costs divisor size times quotient size, so it wins if either is short
+   if (denominatorSize < burnikelZieglerThreshold_ ||
+       numeratorSize - denominatorSize < burnikelZieglerThreshold_) {
+      longDivide(numerator, numeratorSize, denominator, denominatorSize, quotient, remainder);
+   } else {
+      blockDivide(numerator, numeratorSize, denominator, denominatorSize, quotient, remainder,
+                  denominatorSize >= newtonDivisionThreshold_);
+   }
+}
+
+/** longDivide(const Limb*, int, const Limb*, int, Limb*, Limb*)
+ * @brief   Divides one limb array by another with long division (Knuth's Algorithm D).
+ * @param   numerator        Dividend, ordered from lowest limb to highest
+ * @param   numeratorSize    # of limbs in numerator
+ * @param   denominator      Divisor, ordered from lowest limb to highest
+ * @param   denominatorSize  # of limbs in denominator
+ * @param   quotient         Array to write the quotient to
+ * @param   remainder        Array to write the remainder to
+ * @pre     numeratorSize >= denominatorSize >= 1, the highest limb of denominator
+ *          is not 0, quotient has room for numeratorSize - denominatorSize + 1
+ *          limbs and remainder has room for denominatorSize limbs.
+ * @post    All limbs of quotient and remainder have been written.
+*/
+void InfiniteInt::longDivide(const Limb* numerator, int numeratorSize, const Limb* denominator,
+                             int denominatorSize, Limb* quotient, Limb* remainder) {
+   if (denominatorSize == 1) {
+      remainder[0] = divideLimbsBySmall(numerator, numeratorSize, denominator[0], quotient);
+      return;
+   }
+
+   /* Scale both numbers so the divisor's highest limb is at least kLimbBase / 2.
+      That leaves the quotient unchanged and keeps each limb estimated from the
+      leading limbs at most 2 above the true one. */
+   const int n = denominatorSize;
+   const unsigned long long scale = kLimbBase / (denominator[n - 1] + 1ULL);
+   LimbVector u(numeratorSize + 1);     // scaled dividend, reduced to the remainder in place
+   LimbVector v(n);                     // scaled divisor
+   u[numeratorSize] = multiplyLimbsBySmall(numerator, numeratorSize, static_cast<Limb>(scale), u.data());
+   multiplyLimbsBySmall(denominator, n, static_cast<Limb>(scale), v.data());
+   unsigned long long carry{0};
+
+   // Find the quotient one limb at a time, starting with highest
+   const unsigned long long vTop = v[n - 1];
+   const unsigned long long vNext = v[n - 2];
+   for (int j = numeratorSize - n; j >= 0; --j) {
+      // Estimate this limb from the leading limbs, correcting it down while the
+      // next limb of the divisor shows it is too big (at most twice)
+      const unsigned long long leading = u[j + n] * kLimbBase + u[j + n - 1];
+      unsigned long long estimate = leading / vTop;
+      if (estimate >= kLimbBase) {
+         estimate = kLimbBase - 1;
+      }
+      unsigned long long estimateRemainder = leading - estimate * vTop;
+      while (estimateRemainder < kLimbBase &&
+             estimate * vNext > estimateRemainder * kLimbBase + u[j + n - 2]) {
+         --estimate;
+         estimateRemainder += vTop;
+      }
+
+      // Subtract estimate * v from the current window of u
+      unsigned long long productCarry{0};
+      unsigned long long borrow{0};
+      for (int i = 0; i < n; ++i) {
+         unsigned long long product = estimate * v[i] + productCarry;
+         productCarry = product / kLimbBase;
+         unsigned long long subtrahend = product % kLimbBase + borrow;
+         borrow = u[i + j] < subtrahend ? 1 : 0;
+         u[i + j] = static_cast<Limb>(u[i + j] + borrow * kLimbBase - subtrahend);
+      }
+      unsigned long long subtrahend = productCarry + borrow;
+      borrow = u[j + n] < subtrahend ? 1 : 0;
+      u[j + n] = static_cast<Limb>((u[j + n] + borrow * kLimbBase - subtrahend) % kLimbBase);
+
+      // Rarely the estimate is still 1 too big, which shows up as a borrow - add v back
+      if (borrow != 0) {
+         --estimate;
+         carry = 0;
+         for (int i = 0; i < n; ++i) {
+            unsigned long long partialSum = u[i + j] + carry + v[i];
+            carry = partialSum >= kLimbBase ? 1 : 0;
+            u[i + j] = static_cast<Limb>(partialSum - carry * kLimbBase);
+         }
+         u[j + n] = static_cast<Limb>((u[j + n] + carry) % kLimbBase);
+      }
+      quotient[j] = static_cast<Limb>(estimate);
+   }
+
+   // What is left of u is the scaled remainder
+   divideLimbsBySmall(u.data(), n, static_cast<Limb>(scale), remainder);
+}
+
+/** blockDivide(const Limb*, int, const Limb*, int, Limb*, Limb*, bool)
+ * @brief   Divides one limb array by another a block of limbs at a time, dividing
+ *          each block with Burnikel-Ziegler recursion or a Newton reciprocal.
+ * @param   numerator        Dividend, ordered from lowest limb to highest
+ * @param   numeratorSize    # of limbs in numerator
+ * @param   denominator      Divisor, ordered from lowest limb to highest
+ * @param   denominatorSize  # of limbs in denominator
+ * @param   quotient         Array to write the quotient to
+ * @param   remainder        Array to write the remainder to
+ * @param   newton           Divide each block by multiplying with a reciprocal
+ *                           rather than with Burnikel-Ziegler recursion
+ * @pre     numeratorSize >= denominatorSize >= 2, the highest limb of denominator
+ *          is not 0, quotient has room for numeratorSize - denominatorSize + 1
+ *          limbs and remainder has room for denominatorSize limbs.
+ * @post    All limbs of quotient and remainder have been written.
+*/
+void InfiniteInt::blockDivide(const Limb* numerator, int numeratorSize, const Limb* denominator,
+                              int denominatorSize, Limb* quotient, Limb* remainder, bool newton) {
+   /* Burnikel-Ziegler halves the block size until it falls below the threshold,
+      so round the divisor up to a size that halves evenly all the way down */
+   int n = denominatorSize;
+   if (!newton) {
+      int levels{0};
+      int baseSize = denominatorSize;
+      while (baseSize >= burnikelZieglerThreshold_) {
+         baseSize = (baseSize + 1) / 2;
+         ++levels;
+      }
+      n = baseSize << levels;
+   }
+
+   /* Scale the divisor so its highest limb is at least kLimbBase / 2, and pad it
+      with zero limbs at the bottom to fill a block. Doing the same to the
+      dividend leaves the quotient unchanged. */
+   const int shift = n - denominatorSize;
+   const Limb scale = static_cast<Limb>(kLimbBase / (denominator[denominatorSize - 1] + 1ULL));
+   LimbVector a(shift + numeratorSize + 1, 0);   // scaled dividend
+   LimbVector b(n, 0);                           // scaled divisor
+   a.back() = multiplyLimbsBySmall(numerator, numeratorSize, scale, a.data() + shift);
+   if (a.back() == 0) {
+      a.pop_back();
+   }
+
+   /* Split the dividend into blocks of n limbs from the bottom. The limbs left
+      over at the top join the highest block, which is long divided since it
+      only gives a few quotient limbs. If too many are left over they get a
+      block of their own, padded with zero limbs, which is less than b. */
+   int blocks = static_cast<int>(a.size()) / n;
+   int extra = static_cast<int>(a.size()) % n;
+   if (extra >= burnikelZieglerThreshold_) {
+      ++blocks;
+      extra = 0;
+      a.resize(static_cast<std::size_t>(blocks) * n, 0);
+   }
+   multiplyLimbsBySmall(denominator, denominatorSize, scale, b.data() + shift);
+   LimbVector reciprocal;
+   if (newton) {
+      reciprocal = reciprocalLimbs(b.data(), n);
+   }
+
+   // Divide the dividend's blocks from highest to lowest, carrying each remainder down
+   LimbVector blockQuotients(static_cast<std::size_t>(blocks - 1) * n + extra + 1);
+   LimbVector blockRemainder(n);
+   longDivide(a.data() + static_cast<std::size_t>(blocks - 1) * n, n + extra, b.data(), n,
+              blockQuotients.data() + static_cast<std::size_t>(blocks - 1) * n, blockRemainder.data());
+   LimbVector window(2 * n);   // the next block, below the remainder so far
+   for (int i = blocks - 2; i >= 0; --i) {
+      std::copy(a.begin() + static_cast<std::size_t>(i) * n, a.begin() + static_cast<std::size_t>(i + 1) * n,
+                window.begin());
+      std::copy(blockRemainder.begin(), blockRemainder.end(), window.begin() + n);
+      Limb* blockQuotient = blockQuotients.data() + static_cast<std::size_t>(i) * n;
+      if (newton) {
+         divideByReciprocal(window.data(), b.data(), reciprocal, n, blockQuotient, blockRemainder.data());
+      } else {
+         divideTwoByOne(window.data(), b.data(), n, blockQuotient, blockRemainder.data());
+      }
+   }
+
+   // Undo the scaling on the remainder (its padding limbs are all 0)
+   std::copy(blockQuotients.begin(), blockQuotients.begin() + (numeratorSize - denominatorSize + 1), quotient);
+   divideLimbsBySmall(blockRemainder.data() + shift, denominatorSize, scale, remainder);
+}
+
+/** divideTwoByOne(const Limb*, const Limb*, int, Limb*, Limb*)
+ * @brief   Divides a 2n-limb number by an n-limb one with Burnikel-Ziegler recursion.
+ * @param   a           Dividend of 2 * n limbs, ordered from lowest limb to highest
+ * @param   b           Divisor of n limbs, ordered from lowest limb to highest
+ * @param   n           # of limbs in b
+ * @param   quotient    Array to write the n-limb quotient to
+ * @param   remainder   Array to write the n-limb remainder to
+ * @pre     The highest limb of b is at least kLimbBase / 2, and the highest n limbs
+ *          of a hold a number less than b.
+ * @post    All limbs of quotient and remainder have been written.
+*/
+void InfiniteInt::divideTwoByOne(const Limb* a, const Limb* b, int n, Limb* quotient, Limb* remainder) {
+   if (n % 2 != 0 || n < burnikelZieglerThreshold_) {
+      // The quotient's extra limb is always 0, since a's highest half is less than b
+      LimbVector fullQuotient(n + 1);
+      longDivide(a, 2 * n, b, n, fullQuotient.data(), remainder);
+      std::copy(fullQuotient.begin(), fullQuotient.begin() + n, quotient);
+      return;
+   }
+
+   // Split a into four half blocks and divide the highest three, then the rest
+   const int half = n / 2;
+   LimbVector window(3 * half);   // the lowest half block of a above the first remainder
+   divideThreeByTwo(a + half, b, half, quotient + half, window.data() + half);
+   std::copy(a, a + half, window.begin());
+   divideThreeByTwo(window.data(), b, half, quotient, remainder);
+}
+
+/** divideThreeByTwo(const Limb*, const Limb*, int, Limb*, Limb*)
+ * @brief   Divides a 3n-limb number by a 2n-limb one with Burnikel-Ziegler recursion.
+ * @param   a           Dividend of 3 * n limbs, ordered from lowest limb to highest
+ * @param   b           Divisor of 2 * n limbs, ordered from lowest limb to highest
+ * @param   n           Half the # of limbs in b
+ * @param   quotient    Array to write the n-limb quotient to
+ * @param   remainder   Array to write the 2n-limb remainder to
+ * @pre     The highest limb of b is at least kLimbBase / 2, and the highest 2 * n
+ *          limbs of a hold a number less than b.
+ * @post    All limbs of quotient and remainder have been written.
+*/
+void InfiniteInt::divideThreeByTwo(const Limb* a, const Limb* b, int n, Limb* quotient, Limb* remainder) {
+   // With a = [a0, a1, a2] and b = [b0, b1] in blocks of n limbs (lowest first),
+   // estimate the quotient as [a1, a2] / b1, which is at most 2 too big
+   const Limb* a1 = a + n;
+   const Limb* a2 = a + 2 * n;
+   const Limb* b1 = b + n;
+   LimbVector partial(2 * n + 1, 0);   // [a0, remainder of the estimate]
+   if (compareLimbs(a2, n, b1, n) < 0) {
+      divideTwoByOne(a1, b1, n, quotient, partial.data() + n);
+   } else {
+      // a2 == b1, so the estimate is kLimbBase^n - 1, leaving a1 + b1
+      std::fill(quotient, quotient + n, static_cast<Limb>(kLimbBase - 1));
+      partial[2 * n] = addLimbs(a1, n, b1, n, partial.data() + n);
+   }
+   std::copy(a, a + n, partial.begin());
+
+   // Take off the estimate times b0, then add b back while the result is negative
+   SignedLimbs difference(partial.data(), 2 * n + 1);
+   difference.add(SignedLimbs::multiply(SignedLimbs(quotient, n), SignedLimbs(b, n)), true);
+   const SignedLimbs divisor(b, 2 * n);
+   const Limb one{1};
+   while (difference.negative) {
+      difference.add(divisor);
+      subtractLimbsInPlace(quotient, n, &one, 1);
+   }
+   std::fill(remainder, remainder + 2 * n, 0);
+   std::copy(difference.magnitude.begin(), difference.magnitude.end(), remainder);
+}
+
+/** reciprocalLimbs(const Limb*, int)
+ * @brief   Finds the reciprocal of a limb array with Newton's method.
+ * @param   b     The number to invert, ordered from lowest limb to highest
+ * @param   n     # of limbs in b
+ * @pre     The highest limb of b is at least kLimbBase / 2.
+ * @return  floor((kLimbBase^(2n) - 1) / b), in n + 1 limbs.
+*/
+InfiniteInt::LimbVector InfiniteInt::reciprocalLimbs(const Limb* b, int n) {
+   if (n < newtonDivisionThreshold_) {
+      LimbVector allOnes(2 * n, static_cast<Limb>(kLimbBase - 1));
+      LimbVector reciprocal(n + 1);
+      LimbVector remainder(n);
+      divideLimbs(allOnes.data(), 2 * n, b, n, reciprocal.data(), remainder.data());
+      return reciprocal;
+   }
+
+   /* Start from y, the reciprocal of b's highest half, so x = y * kLimbBase^low
+      is right to about half the limbs. Its low limbs are all 0, so products
+      with x are taken with y and shifted. */
+   const int high = (n + 1) / 2;
+   const int low = n - high;
+   LimbVector highReciprocal = reciprocalLimbs(b + low, high);
+   const SignedLimbs y(highReciprocal.data(), high + 1);
+   const SignedLimbs divisor(b, n);
+
+   // error = kLimbBase^(2n) - b * x
+   SignedLimbs error(nullptr, 0);
+   error.magnitude.assign(2 * n, 0);
+   error.magnitude.push_back(1);
+   SignedLimbs product = SignedLimbs::multiply(divisor, y);
+   product.shiftUp(low);
+   error.add(product, true);
+
+   /* One Newton step, x += x * error / kLimbBase^(2n), doubles the limbs that
+      are right. error is below kLimbBase^(n + low + 2), so its lowest n - 1
+      limbs are dropped first, which changes the step by less than 1. */
+   SignedLimbs errorHigh(error);
+   errorHigh.shiftDown(n - 1);
+   SignedLimbs step = SignedLimbs::multiply(y, errorHigh);
+   step.shiftDown(high + 1);
+   SignedLimbs x(y);
+   x.shiftUp(low);
+   x.add(step);
+
+   // The step leaves x within a few units, so settle it by checking the
+   // remainder kLimbBase^(2n) - 1 - b * x, which is error - b * step - 1
+   const Limb one{1};
+   const SignedLimbs unit(&one, 1);
+   SignedLimbs remainder(error);
+   remainder.add(unit, true);
+   remainder.add(SignedLimbs::multiply(divisor, step), true);
+   while (remainder.negative) {
+      x.add(unit, true);
+      remainder.add(divisor);
+   }
+   while (compareLimbs(remainder.magnitude.data(), static_cast<int>(remainder.magnitude.size()), b, n) >= 0) {
+      x.add(unit);
+      remainder.add(divisor, true);
+   }
+   x.magnitude.resize(n + 1, 0);
+   return x.magnitude;
+}
+
+/** divideByReciprocal(const Limb*, const Limb*, const LimbVector&, int, Limb*, Limb*)
+ * @brief   Divides a 2n-limb number by an n-limb one by multiplying with its reciprocal.
+ * @param   a           Dividend of 2 * n limbs, ordered from lowest limb to highest
+ * @param   b           Divisor of n limbs, ordered from lowest limb to highest
+ * @param   reciprocal  b's reciprocal, as returned by reciprocalLimbs
+ * @param   n           # of limbs in b
+ * @param   quotient    Array to write the n-limb quotient to
+ * @param   remainder   Array to write the n-limb remainder to
+ * @pre     The highest limb of b is at least kLimbBase / 2, and the highest n limbs
+ *          of a hold a number less than b.
+ * @post    All limbs of quotient and remainder have been written.
+*/
+void InfiniteInt::divideByReciprocal(const Limb* a, const Limb* b, const LimbVector& reciprocal, int n,
+                                     Limb* quotient, Limb* remainder) {
+   /* Estimate the quotient from a's highest n + 1 limbs times the reciprocal,
+      which is never above the quotient and at most 3 below it */
+   const int reciprocalSize = static_cast<int>(reciprocal.size());
+   LimbVector product(n + 1 + reciprocalSize);
+   multiplyLimbs(a + (n - 1), n + 1, reciprocal.data(), reciprocalSize, product.data());
+   std::copy(product.begin() + (n + 1), product.begin() + (2 * n + 1), quotient);
+
+   // Find the remainder, and take b off it while it is still too big
+   LimbVector partial(a, a + 2 * n);
+   LimbVector quotientTimesB(2 * n);
+   multiplyLimbs(quotient, n, b, n, quotientTimesB.data());
+   subtractLimbsInPlace(partial.data(), 2 * n, quotientTimesB.data(), 2 * n);
+   const Limb one{1};
+   while (compareLimbs(partial.data(), 2 * n, b, n) >= 0) {
+      subtractLimbsInPlace(partial.data(), 2 * n, b, n);
+      addLimbsInPlace(quotient, n, &one, 1);
+   }
+   std::copy(partial.begin(), partial.begin() + n, remainder);
+}
+
+/** multiplyLimbsBySmall(const Limb*, int, Limb, Limb*)
+ * @brief   Multiplies a limb array by a single limb.
+ * @param   limbs    The number to multiply, ordered from lowest limb to highest
+ * @param   size     # of limbs in limbs
+ * @param   factor   The limb to multiply by
+ * @param   product  Array to write the lowest size limbs of the product to (may be limbs)
+ * @return  The limb carried out of the top of the product.
+*/
+InfiniteInt::Limb InfiniteInt::multiplyLimbsBySmall(const Limb* limbs, int size, Limb factor, Limb* product) {
+   unsigned long long carry{0};
+   for (int i = 0; i < size; ++i) {
+      unsigned long long current = limbs[i] * static_cast<unsigned long long>(factor) + carry;
+      product[i] = static_cast<Limb>(current % kLimbBase);
+      carry = current / kLimbBase;
+   }
+   return static_cast<Limb>(carry);
+}
+
+/** divideLimbsBySmall(const Limb*, int, Limb, Limb*)
+ * @brief   Divides a limb array by a single limb.
+ * @param   numerator        Dividend, ordered from lowest limb to highest
+ * @param   numeratorSize    # of limbs in numerator
+ * @param   denominator      Divisor (not 0)
+ * @param   quotient         Array to write the quotient to (may be numerator)
+ * @pre     quotient has room for numeratorSize limbs.
+ * @return  The remainder.
+*/
+InfiniteInt::Limb InfiniteInt::divideLimbsBySmall(const Limb* numerator, int numeratorSize,
+                                                  Limb denominator, Limb* quotient) {
+   unsigned long long partialRemainder{0};
+   for (int i = numeratorSize - 1; i >= 0; --i) {
+      unsigned long long partialDividend = partialRemainder * kLimbBase + numerator[i];
+      quotient[i] = static_cast<Limb>(partialDividend / denominator);
+      partialRemainder = partialDividend % denominator;
+   }
+   return static_cast<Limb>(partialRemainder);
+}
+
+/** binaryGcd(unsigned long long, unsigned long long)
+ * @brief   Finds the gcd of two machine words with Stein's binary algorithm.
+ * @param   lhs      First number
+ * @param   rhs      Second number
+ * @return  The gcd (0 only if both numbers are 0).
+*/
+unsigned long long InfiniteInt::binaryGcd(unsigned long long lhs, unsigned long long rhs) {
+   if (lhs == 0 || rhs == 0) {
+      return lhs | rhs;
+   }
+
+   // Shifts and subtractions replace division: the common factors of 2 come
+   // out first, then the odd parts are subtracted until they meet
+   const int shift = __builtin_ctzll(lhs | rhs);
+   lhs >>= __builtin_ctzll(lhs);
+   do {
+      rhs >>= __builtin_ctzll(rhs);
+      if (lhs > rhs) {
+         std::swap(lhs, rhs);
+      }
+      rhs -= lhs;
+   } while (rhs != 0);
+   return lhs << shift;
+}
+
+/** extendedWordGcd(long long, long long, long long&)
+ * @brief   Finds the gcd of two non-negative machine words with the extended
+ *          Euclidean algorithm.
+ * @param   lhs          First number
+ * @param   rhs          Second number
+ * @param   coefficient  Set to a number x, |x| <= max(rhs, 1), with lhs * x
+ *                       congruent to the gcd modulo rhs
+ * @return  The gcd (0 only if both numbers are 0).
+*/
+long long InfiniteInt::extendedWordGcd(long long lhs, long long rhs, long long& coefficient) {
+   long long current{1};      // lhs's multiplier for lhs itself
+   long long following{0};    // lhs's multiplier for rhs
+   while (rhs != 0) {
+      const long long q = lhs / rhs;
+      long long t = lhs - q * rhs;
+      lhs = rhs;
+      rhs = t;
+      t = current - q * following;
+      current = following;
+      following = t;
+   }
+   coefficient = current;
+   return lhs;
+}
+
+/** GcdMatrix
+ * @brief   A 2x2 matrix of non-negative numbers with determinant 1. Half-GCD
+ *          builds one to take the numbers it has reduced back to the ones it
+ *          started from.
+*/
+struct InfiniteInt::GcdMatrix {
+   LimbVector entry[2][2];   // entry[row][column], lowest limb first, with no leading zero limbs
+
+   /** GcdMatrix()
+    * @brief   Constructs the identity matrix.
+   */
+   GcdMatrix() {
+      entry[0][0].push_back(1);
+      entry[1][1].push_back(1);
+   }
+
+   /** at(int, int)
+    * @brief   Returns one entry as a signed number.
+   */
+   SignedLimbs at(int row, int column) const {
+      return SignedLimbs(entry[row][column].data(), static_cast<int>(entry[row][column].size()));
+   }
+
+   /** combine(const LimbVector&, long long, const LimbVector&, long long)
+    * @brief   Returns lhsFactor * lhs + rhsFactor * rhs, for factors in [0, 2^31).
+   */
+   static LimbVector combine(const LimbVector& lhs, long long lhsFactor, const LimbVector& rhs, long long rhsFactor) {
+      const bool lhsLonger = lhs.size() >= rhs.size();
+      const LimbVector& longer = lhsLonger ? lhs : rhs;
+      const unsigned long long longerFactor = static_cast<unsigned long long>(lhsLonger ? lhsFactor : rhsFactor);
+      const size_t common = std::min(lhs.size(), rhs.size());
+      LimbVector result(longer.size());
+      unsigned long long carry{0};
+      size_t i{0};
+      for (; i < common; ++i) {
+         unsigned long long current = lhs[i] * static_cast<unsigned long long>(lhsFactor) +
+                                      rhs[i] * static_cast<unsigned long long>(rhsFactor) + carry;
+         result[i] = static_cast<Limb>(current % kLimbBase);
+         carry = current / kLimbBase;
+      }
+      for (; i < longer.size(); ++i) {
+         unsigned long long current = longer[i] * longerFactor + carry;
+         result[i] = static_cast<Limb>(current % kLimbBase);
+         carry = current / kLimbBase;
+      }
+      for (; carry != 0; carry /= kLimbBase) {
+         result.push_back(static_cast<Limb>(carry % kLimbBase));
+      }
+      while (!result.empty() && result.back() == 0) {
+         result.pop_back();
+      }
+      return result;
+   }
+
+   /** multiplyByLehmerInverse(const long long*)
+    * @brief   Multiplies this matrix on the right by the inverse of a matrix
+    *          {A, B, C, D} from lehmerMatrix(), which is {D, -B, -C, A} and so
+    *          has no negative entries.
+   */
+   void multiplyByLehmerInverse(const long long* lehmer) {
+      for (int row = 0; row < 2; ++row) {
+         LimbVector first = combine(entry[row][0], lehmer[3], entry[row][1], -lehmer[2]);
+         entry[row][1] = combine(entry[row][0], -lehmer[1], entry[row][1], lehmer[0]);
+         entry[row][0].swap(first);
+      }
+   }
+
+   /** addQuotient(int, const LimbVector&)
+    * @brief   Multiplies this matrix on the right by the inverse of a Euclidean
+    *          step: {1, q, 0, 1} if a was reduced by q * b, or {1, 0, q, 1} if
+    *          b was reduced by q * a.
+    * @param   reduced  1 if a was reduced or 2 if b was, as from gcdDivideStep()
+    * @param   quotient q
+   */
+   void addQuotient(int reduced, const LimbVector& quotient) {
+      const int from = reduced == 1 ? 0 : 1;
+      const SignedLimbs q(quotient.data(), static_cast<int>(quotient.size()));
+      for (int row = 0; row < 2; ++row) {
+         SignedLimbs sum = at(row, 1 - from);
+         sum.add(SignedLimbs::multiply(at(row, from), q));
+         entry[row][1 - from].swap(sum.magnitude);
+      }
+   }
+
+   /** multiply(const GcdMatrix&)
+    * @brief   Multiplies this matrix on the right by another.
+   */
+   void multiply(const GcdMatrix& rhs) {
+      GcdMatrix product;
+      for (int row = 0; row < 2; ++row) {
+         for (int column = 0; column < 2; ++column) {
+            SignedLimbs sum = SignedLimbs::multiply(at(row, 0), rhs.at(0, column));
+            sum.add(SignedLimbs::multiply(at(row, 1), rhs.at(1, column)));
+            product.entry[row][column].swap(sum.magnitude);
+         }
+      }
+      for (int row = 0; row < 2; ++row) {
+         entry[row][0].swap(product.entry[row][0]);
+         entry[row][1].swap(product.entry[row][1]);
+      }
+   }
+};
+
+/** gcdLimbs(LimbVector, LimbVector, InfiniteInt*)
+ * @brief   Finds the gcd of two magnitudes with half-GCD and Lehmer steps,
+ *          finishing with binary GCD once both fit in a machine word.
+ * @param   a          First magnitude, lowest limb first
+ * @param   b          Second magnitude, lowest limb first
+ * @param   cofactor   If not null, set to a number x with a * x congruent to the
+ *                     gcd modulo b
+ * @return  The gcd, lowest limb first, with no leading zero limbs.
+*/
+InfiniteInt::LimbVector InfiniteInt::gcdLimbs(LimbVector a, LimbVector b, InfiniteInt* cofactor) {
+   auto trim = [](LimbVector& limbs) {
+      while (!limbs.empty() && limbs.back() == 0) {
+         limbs.pop_back();
+      }
+   };
+   auto wordValue = [](const LimbVector& limbs) {
+      unsigned long long value{0};
+      for (int i = static_cast<int>(limbs.size()) - 1; i >= 0; --i) {
+         value = value * kLimbBase + limbs[i];
+      }
+      return value;
+   };
+   auto wordLimbs = [](long long value) {
+      unsigned long long magnitude = wordMagnitude(value);
+      Limb limbs[3];
+      int size{0};
+      for (; magnitude != 0; magnitude /= kLimbBase) {
+         limbs[size++] = static_cast<Limb>(magnitude % kLimbBase);
+      }
+      SignedLimbs result(limbs, size);
+      result.negative = value < 0;
+      return result;
+   };
+   /* Euclid's multipliers alternate in sign, as do the entries of each row of a
+      Lehmer matrix, so the two products in a row normally have the same sign and
+      the new magnitude is a sum, which one pass forms */
+   auto combineCofactors = [&wordLimbs](const SignedLimbs& lhs, long long lhsFactor,
+                                        const SignedLimbs& rhs, long long rhsFactor) {
+      const bool lhsNegative = lhs.negative != (lhsFactor < 0);
+      const bool rhsNegative = rhs.negative != (rhsFactor < 0);
+      if (lhs.magnitude.empty() || rhs.magnitude.empty() || lhsNegative == rhsNegative) {
+         SignedLimbs result(nullptr, 0);
+         result.magnitude = GcdMatrix::combine(lhs.magnitude, std::abs(lhsFactor), rhs.magnitude, std::abs(rhsFactor));
+         result.negative = lhs.magnitude.empty() || lhsFactor == 0 ? rhsNegative : lhsNegative;
+         result.trim();
+         return result;
+      }
+      SignedLimbs result = SignedLimbs::multiply(lhs, wordLimbs(lhsFactor));
+      result.add(SignedLimbs::multiply(rhs, wordLimbs(rhsFactor)));
+      return result;
+   };
+   trim(a);
+   trim(b);
+
+   // Only the multipliers of the original a are tracked: a is congruent to
+   // first * (original a), and b to second * (original a), modulo the original b
+   const Limb one = 1;
+   SignedLimbs first(&one, 1);
+   SignedLimbs second(nullptr, 0);
+   LimbVector spare;          // scratch for the steps, and the quotient of a division step
+   long long lehmer[4];       // the matrix of a Lehmer block
+
+   while (!a.empty() && !b.empty()) {
+      const int size = static_cast<int>(std::max(a.size(), b.size()));
+
+      // Finish in hardware once both numbers are below 2^63
+      const unsigned long long kWordLimit = 1ULL << 63;
+      if (size <= 2 && wordValue(a) < kWordLimit && wordValue(b) < kWordLimit) {
+         const long long aValue = static_cast<long long>(wordValue(a));
+         const long long bValue = static_cast<long long>(wordValue(b));
+         long long gcd{0};
+         if (cofactor != nullptr) {
+            long long coefficient{0};
+            gcd = extendedWordGcd(aValue, bValue, coefficient);
+            const long long bCoefficient = static_cast<long long>(
+               (gcd - static_cast<__int128>(aValue) * coefficient) / bValue);
+            first = SignedLimbs::multiply(first, wordLimbs(coefficient));
+            first.add(SignedLimbs::multiply(second, wordLimbs(bCoefficient)));
+            cofactor->assignMagnitude(first.magnitude, first.negative);
+         } else {
+            gcd = static_cast<long long>(binaryGcd(aValue, bValue));
+         }
+         return wordLimbs(gcd).magnitude;
+      }
+
+      // Long numbers first reduce their top third with half-GCD, which takes them
+      // about a third of the way down with subquadratic work
+      if (size >= halfGcdThreshold_) {
+         GcdMatrix matrix;
+         if (reduceHighLimbs(a, b, 2 * size / 3, matrix)) {
+            if (cofactor != nullptr) {
+               SignedLimbs nextFirst = SignedLimbs::multiply(matrix.at(1, 1), first);
+               nextFirst.add(SignedLimbs::multiply(matrix.at(0, 1), second), true);
+               second = SignedLimbs::multiply(matrix.at(0, 0), second);
+               second.add(SignedLimbs::multiply(matrix.at(1, 0), first), true);
+               std::swap(first, nextFirst);
+            }
+            continue;
+         }
+      }
+
+      // A Lehmer block takes many steps for two linear passes; when the leading
+      // limbs cannot fix even one quotient, a full division step is taken instead
+      if (lehmerMatrix(a, b, 0, lehmer)) {
+         applyLehmerMatrix(a, b, lehmer, spare);
+         if (cofactor != nullptr) {
+            SignedLimbs nextFirst = combineCofactors(first, lehmer[0], second, lehmer[1]);
+            second = combineCofactors(first, lehmer[2], second, lehmer[3]);
+            std::swap(first, nextFirst);
+         }
+      } else {
+         const int reduced = gcdDivideStep(a, b, 0, spare);
+         if (cofactor != nullptr) {
+            const SignedLimbs quotient(spare.data(), static_cast<int>(spare.size()));
+            if (reduced == 1) {
+               first.add(SignedLimbs::multiply(second, quotient), true);
+            } else {
+               second.add(SignedLimbs::multiply(first, quotient), true);
+            }
+         }
+      }
+   }
+
+   if (cofactor != nullptr) {
+      const SignedLimbs& last = b.empty() ? first : second;
+      cofactor->assignMagnitude(last.magnitude, last.negative);
+   }
+   return b.empty() ? a : b;
+}
+
+/** lehmerMatrix(const LimbVector&, const LimbVector&, int, long long*)
+ * @brief   Runs Euclid's algorithm on the leading 62 bits of two magnitudes,
+ *          keeping only the steps whose quotients are certain to be the full
+ *          numbers' quotients.
+ * @param   a        First magnitude, lowest limb first, with no leading zero limbs
+ * @param   b        Second magnitude, likewise
+ * @param   s        Steps must leave both numbers at least kLimbBase^s (or, if s
+ *                   is 0, above 0)
+ * @param   matrix   Set to {A, B, C, D}: the steps take a and b to A * a + B * b
+ *                   and C * a + D * b. Every entry is below 2^31 in magnitude,
+ *                   the determinant is 1 and each row's entries differ in sign.
+ * @return  true if at least one step was found.
+*/
+bool InfiniteInt::lehmerMatrix(const LimbVector& a, const LimbVector& b, int s, long long* matrix) {
+   const int aSize = static_cast<int>(a.size());
+   const int bSize = static_cast<int>(b.size());
+   if (aSize == 0 || bSize == 0) {
+      return false;
+   }
+
+   // Approximate both numbers by their value above limb k and a common bit shift
+   const int size = std::max(aSize, bSize);
+   const int k = std::max(size - 3, 0);
+   unsigned __int128 aTop{0};
+   unsigned __int128 bTop{0};
+   for (int i = size - 1; i >= k; --i) {
+      aTop = aTop * kLimbBase + (i < aSize ? a[i] : 0);
+      bTop = bTop * kLimbBase + (i < bSize ? b[i] : 0);
+   }
+   const unsigned __int128 top = std::max(aTop, bTop);
+   const unsigned long long topHigh = static_cast<unsigned long long>(top >> 64);
+   const int bits = topHigh != 0 ? 128 - __builtin_clzll(topHigh)
+                                 : 64 - __builtin_clzll(static_cast<unsigned long long>(top));
+   const int shift = std::max(bits - 62, 0);
+   long long x = static_cast<long long>(aTop >> shift);
+   long long y = static_cast<long long>(bTop >> shift);
+
+   // kLimbBase^s, in units of the approximations, rounded up
+   long long limit{1};
+   if (s >= k) {
+      if (s - k > 3) {
+         return false;
+      }
+      unsigned __int128 power{1};
+      for (int i = k; i < s; ++i) {
+         power *= kLimbBase;
+      }
+      power = (power + (static_cast<unsigned __int128>(1) << shift) - 1) >> shift;
+      if (power >= (static_cast<unsigned __int128>(1) << 62)) {
+         return false;
+      }
+      limit = std::max(static_cast<long long>(power), 1LL);
+   }
+
+   /* With the matrix so far, the true a' lies between x plus the negative entries
+      of its row and x plus the positive ones (scaled), and likewise b'. A step is
+      kept only if its quotient is the same at both ends of those ranges, so it is
+      certainly the true quotient, and the reduced number stays above the limit. */
+   const long long kCofactorLimit = 1LL << 31;
+   long long A{1};
+   long long B{0};
+   long long C{0};
+   long long D{1};
+   bool stepped{false};
+   for (;;) {
+      const long long xLow = x + std::min(A, 0LL) + std::min(B, 0LL);
+      const long long xHigh = x + std::max(A, 0LL) + std::max(B, 0LL);
+      const long long yLow = y + std::min(C, 0LL) + std::min(D, 0LL);
+      const long long yHigh = y + std::max(C, 0LL) + std::max(D, 0LL);
+      if (xLow < limit || yLow < limit) {
+         break;
+      }
+
+      if (x > y) {
+         const long long q = xLow / yHigh;
+         if (q == 0 || q != xHigh / yLow || q >= kCofactorLimit) {
+            break;
+         }
+         const long long nextA = A - q * C;
+         const long long nextB = B - q * D;
+         const long long nextX = x - q * y;
+         if (std::max(std::abs(nextA), std::abs(nextB)) >= kCofactorLimit ||
+             nextX + std::min(nextA, 0LL) + std::min(nextB, 0LL) < limit) {
+            break;
+         }
+         A = nextA;
+         B = nextB;
+         x = nextX;
+      } else if (y > x) {
+         const long long q = yLow / xHigh;
+         if (q == 0 || q != yHigh / xLow || q >= kCofactorLimit) {
+            break;
+         }
+         const long long nextC = C - q * A;
+         const long long nextD = D - q * B;
+         const long long nextY = y - q * x;
+         if (std::max(std::abs(nextC), std::abs(nextD)) >= kCofactorLimit ||
+             nextY + std::min(nextC, 0LL) + std::min(nextD, 0LL) < limit) {
+            break;
+         }
+         C = nextC;
+         D = nextD;
+         y = nextY;
+      } else {
+         break;
+      }
+      stepped = true;
+   }
+
+   matrix[0] = A;
+   matrix[1] = B;
+   matrix[2] = C;
+   matrix[3] = D;
+   return stepped;
+}
+
+/** applyLehmerMatrix(LimbVector&, LimbVector&, const long long*, LimbVector&)
+ * @brief   Replaces two magnitudes with the combinations a matrix from
+ *          lehmerMatrix() gives.
+ * @param   a        First magnitude; set to A * a + B * b
+ * @param   b        Second magnitude; set to C * a + D * b
+ * @param   matrix   {A, B, C, D}, as set by lehmerMatrix() for a and b
+ * @param   spare    Scratch array (its contents are lost)
+ * @post    a and b have no leading zero limbs.
+*/
+void InfiniteInt::applyLehmerMatrix(LimbVector& a, LimbVector& b, const long long* matrix, LimbVector& spare) {
+   const int size = static_cast<int>(std::max(a.size(), b.size()));
+   a.resize(size, 0);
+   b.resize(size, 0);
+   spare.resize(size);
+
+   // Each row's entries differ in sign and are below 2^31, so a column's sum fits
+   // in a long long; the carries are floored, since the sums may be negative
+   auto splitColumn = [](long long column, long long& carry) {
+#ifdef INFINITEINT_BINARY
+      carry = column >> 32;
+      return static_cast<Limb>(column);
+#else
+      const long long base = static_cast<long long>(kLimbBase);
+      long long high = column / base;
+      long long low = column - high * base;
+      if (low < 0) {
+         low += base;
+         --high;
+      }
+      carry = high;
+      return static_cast<Limb>(low);
+#endif
+   };
+
+   // b is overwritten as it is read, which is safe since column i reads only limb i
+   long long aCarry{0};
+   long long bCarry{0};
+   for (int i = 0; i < size; ++i) {
+      const long long aLimb = a[i];
+      const long long bLimb = b[i];
+      spare[i] = splitColumn(matrix[0] * aLimb + matrix[1] * bLimb + aCarry, aCarry);
+      b[i] = splitColumn(matrix[2] * aLimb + matrix[3] * bLimb + bCarry, bCarry);
+   }
+   a.swap(spare);
+   while (!a.empty() && a.back() == 0) {
+      a.pop_back();
+   }
+   while (!b.empty() && b.back() == 0) {
+      b.pop_back();
+   }
+}
+
+/** gcdDivideStep(LimbVector&, LimbVector&, int, LimbVector&)
+ * @brief   Replaces the larger of two magnitudes with its remainder modulo the
+ *          smaller, as one Euclidean step. With s above 0 the step follows
+ *          half-GCD's rule: it leaves both numbers at least kLimbBase^s, taking
+ *          one fewer multiple if the remainder would fall below that.
+ * @param   a          First magnitude, with no leading zero limbs
+ * @param   b          Second magnitude, likewise
+ * @param   s          0 for a plain Euclidean step, or the half-GCD bound
+ * @param   quotient   Set to the multiple subtracted, with no leading zero limbs
+ * @return  0 if no step was taken, 1 if a was reduced or 2 if b was.
+*/
+int InfiniteInt::gcdDivideStep(LimbVector& a, LimbVector& b, int s, LimbVector& quotient) {
+   const int order = compareLimbs(a.data(), static_cast<int>(a.size()), b.data(), static_cast<int>(b.size()));
+   if (order == 0 && s > 0) {
+      return 0;
+   }
+   LimbVector& larger = order >= 0 ? a : b;
+   const LimbVector& smaller = order >= 0 ? b : a;
+   const int largerSize = static_cast<int>(larger.size());
+   const int smallerSize = static_cast<int>(smaller.size());
+   if (smallerSize == 0 || (s > 0 && smallerSize <= s)) {
+      return 0;
+   }
+
+   quotient.assign(largerSize - smallerSize + 1, 0);
+   LimbVector remainder(smallerSize + 1, 0);
+   if (smallerSize == 1) {
+      remainder[0] = divideLimbsBySmall(larger.data(), largerSize, smaller[0], quotient.data());
+   } else {
+      divideLimbs(larger.data(), largerSize, smaller.data(), smallerSize, quotient.data(), remainder.data());
+   }
+   while (!quotient.empty() && quotient.back() == 0) {
+      quotient.pop_back();
+   }
+
+   // Half-GCD must keep both numbers at least kLimbBase^s, so a remainder below
+   // that gets the smaller number added back (unless that undoes the whole step)
+   int remainderSize = smallerSize;
+   while (remainderSize > 0 && remainder[remainderSize - 1] == 0) {
+      --remainderSize;
+   }
+   if (s > 0 && remainderSize <= s) {
+      if (quotient.size() == 1 && quotient[0] == 1) {
+         return 0;
+      }
+      const Limb one = 1;
+      subtractLimbsInPlace(quotient.data(), static_cast<int>(quotient.size()), &one, 1);
+      if (quotient.back() == 0) {
+         quotient.pop_back();
+      }
+      addLimbsInPlace(remainder.data(), smallerSize + 1, smaller.data(), smallerSize);
+   }
+   while (!remainder.empty() && remainder.back() == 0) {
+      remainder.pop_back();
+   }
+   larger.swap(remainder);
+   return order >= 0 ? 1 : 2;
+}
+
+/** halfGcd(LimbVector&, LimbVector&, GcdMatrix&)
+ * @brief   Runs Euclid's algorithm on two n-limb magnitudes only while both
+ *          stay at least kLimbBase^s, s = n / 2 + 1, recursing on their top
+ *          halves from halfGcdThreshold() limbs (Moller's half-GCD).
+ * @param   a        First magnitude, with no leading zero limbs; reduced in place
+ * @param   b        Second magnitude, likewise
+ * @param   matrix   The identity on entry; set to the matrix taking the reduced
+ *                   numbers back to the originals
+ * @return  true if at least one step was taken.
+*/
+bool InfiniteInt::halfGcd(LimbVector& a, LimbVector& b, GcdMatrix& matrix) {
+   const int n = static_cast<int>(std::max(a.size(), b.size()));
+   const int s = n / 2 + 1;
+   if (a.empty() || b.empty() || n <= s) {
+      return false;
+   }
+
+   bool reduced{false};
+   LimbVector spare;          // scratch for the steps
+   if (n >= halfGcdThreshold_) {
+      /* The matrix that reduces the top half of the limbs also reduces the whole
+         numbers about a quarter of the way (Moller's lemma). Single steps bring
+         them to 3n/4 limbs, and the matrix for the top of what is left takes them
+         the rest of the way, so each level does two half-size recursions. */
+      reduced = reduceHighLimbs(a, b, n / 2, matrix);
+      int size = static_cast<int>(std::max(a.size(), b.size()));
+      while (size > 3 * n / 4 + 1) {
+         if (!halfGcdStep(a, b, s, matrix, spare)) {
+            return reduced;
+         }
+         reduced = true;
+         size = static_cast<int>(std::max(a.size(), b.size()));
+      }
+      if (size > s + 2 && reduceHighLimbs(a, b, 2 * s - size + 1, matrix)) {
+         reduced = true;
+      }
+   }
+
+   while (halfGcdStep(a, b, s, matrix, spare)) {
+      reduced = true;
+   }
+   return reduced;
+}
+
+/** halfGcdStep(LimbVector&, LimbVector&, int, GcdMatrix&, LimbVector&)
+ * @brief   Takes one Lehmer block or Euclidean step of half-GCD.
+ * @param   a        First magnitude, with no leading zero limbs; reduced in place
+ * @param   b        Second magnitude, likewise
+ * @param   s        Both numbers must stay at least kLimbBase^s
+ * @param   matrix   Multiplied on the right by the inverse of the step taken
+ * @param   spare    Scratch array (its contents are lost)
+ * @return  true if a step was taken.
+*/
+bool InfiniteInt::halfGcdStep(LimbVector& a, LimbVector& b, int s, GcdMatrix& matrix, LimbVector& spare) {
+   long long lehmer[4];
+   if (lehmerMatrix(a, b, s, lehmer)) {
+      applyLehmerMatrix(a, b, lehmer, spare);
+      matrix.multiplyByLehmerInverse(lehmer);
+      return true;
+   }
+   const int reduced = gcdDivideStep(a, b, s, spare);
+   if (reduced == 0) {
+      return false;
+   }
+   matrix.addQuotient(reduced, spare);
+   return true;
+}
+
+/** reduceHighLimbs(LimbVector&, LimbVector&, int, GcdMatrix&)
+ * @brief   Runs halfGcd() on two magnitudes' limbs from p up, and applies the
+ *          matrix found to the whole numbers.
+ * @param   a        First magnitude, with no leading zero limbs; reduced in place
+ * @param   b        Second magnitude, likewise
+ * @param   p        # of low limbs left out of the recursion
+ * @param   matrix   Multiplied on the right by the matrix found
+ * @return  true if the high limbs could be reduced.
+*/
+bool InfiniteInt::reduceHighLimbs(LimbVector& a, LimbVector& b, int p, GcdMatrix& matrix) {
+   if (static_cast<int>(a.size()) <= p || static_cast<int>(b.size()) <= p) {
+      return false;
+   }
+   LimbVector highA(a.begin() + p, a.end());
+   LimbVector highB(b.begin() + p, b.end());
+   GcdMatrix high;
+   if (!halfGcd(highA, highB, high)) {
+      return false;
+   }
+
+   /* The reduced numbers are high's inverse, {m11, -m01, -m10, m00}, times a and
+      b: the reduced high limbs, shifted back up, plus the inverse times the low
+      limbs. Neither comes out negative. */
+   const SignedLimbs lowA(a.data(), p);
+   const SignedLimbs lowB(b.data(), p);
+   SignedLimbs nextA(highA.data(), static_cast<int>(highA.size()));
+   nextA.shiftUp(p);
+   nextA.add(SignedLimbs::multiply(high.at(1, 1), lowA));
+   nextA.add(SignedLimbs::multiply(high.at(0, 1), lowB), true);
+   SignedLimbs nextB(highB.data(), static_cast<int>(highB.size()));
+   nextB.shiftUp(p);
+   nextB.add(SignedLimbs::multiply(high.at(0, 0), lowB));
+   nextB.add(SignedLimbs::multiply(high.at(1, 0), lowA), true);
+   a.swap(nextA.magnitude);
+   b.swap(nextB.magnitude);
+   matrix.multiply(high);
+   return true;
+}
+
+/** toomMultiply(const Limb*, int, int, const Limb*, int, int, Limb*)
+ * @brief   Multiplies two limb arrays by splitting them into equal-sized pieces,
+ *          treating the pieces as polynomial coefficients, multiplying the
+ *          polynomials' values at a few small points and interpolating the
+ *          product's coefficients from them.
+ * @param   lhs         First factor, ordered from lowest limb to highest
+ * @param   lhsSize     # of limbs in lhs
+ * @param   lhsPieces   # of pieces to split lhs into
+ * @param   rhs         Second factor, ordered from lowest limb to highest
+ * @param   rhsSize     # of limbs in rhs
+ * @param   rhsPieces   # of pieces to split rhs into
+ * @param   product     Array to write the product to
+ * @pre     As for multiplyLimbs, lhsSize >= rhsSize >= 4 and lhsPieces + rhsPieces
+ *          is 5 (Toom-2.5) or 6 (Toom-3, Toom-4.2).
+ * @post    All lhsSize + rhsSize limbs of product have been written.
+*/
+void InfiniteInt::toomMultiply(const Limb* lhs, int lhsSize, int lhsPieces,
+                               const Limb* rhs, int rhsSize, int rhsPieces, Limb* product) {
+   // Pick a piece size that fits each operand into its # of pieces
+   const int pieceSize = std::max((lhsSize + lhsPieces - 1) / lhsPieces, (rhsSize + rhsPieces - 1) / rhsPieces);
+   std::vector<SignedLimbs> lhsCoefficients;   // pieces of lhs, lowest first (a high piece may be zero)
+   std::vector<SignedLimbs> rhsCoefficients;   // pieces of rhs, lowest first
+   const bool squaring = lhs == rhs && lhsSize == rhsSize && lhsPieces == rhsPieces;
+   for (int i = 0; i < lhsPieces; ++i) {
+      int start = std::min(i * pieceSize, lhsSize);
+      lhsCoefficients.push_back(SignedLimbs(lhs + start, std::min(pieceSize, lhsSize - start)));
+   }
+   for (int i = 0; i < rhsPieces && !squaring; ++i) {
+      int start = std::min(i * pieceSize, rhsSize);
+      rhsCoefficients.push_back(SignedLimbs(rhs + start, std::min(pieceSize, rhsSize - start)));
+   }
+
+   // Evaluate a polynomial at a small point with Horner's rule
+   auto evaluate = [](const std::vector<SignedLimbs>& coefficients, int point) {
+      SignedLimbs value(coefficients.back());
+      for (int i = static_cast<int>(coefficients.size()) - 2; i >= 0; --i) {
+         value.multiplyBySmall(static_cast<Limb>(point < 0 ? -point : point));
+         if (point < 0 && !value.magnitude.empty()) {
+            value.negative = !value.negative;
+         }
+         value.add(coefficients[i]);
+      }
+      return value;
+   };
+   // When squaring, each value is the square of one evaluation (multiply squares
+   // a number it is given twice)
+   const std::vector<SignedLimbs>& rhsPolynomial = squaring ? lhsCoefficients : rhsCoefficients;
+   auto valueAt = [&](int point) {
+      SignedLimbs lhsValue = evaluate(lhsCoefficients, point);
+      return squaring ? SignedLimbs::multiply(lhsValue, lhsValue)
+                      : SignedLimbs::multiply(lhsValue, evaluate(rhsPolynomial, point));
+   };
+
+   // Values of the product polynomial at 0, 1, -1 and infinity (its leading coefficient)
+   SignedLimbs atZero = SignedLimbs::multiply(lhsCoefficients.front(), rhsPolynomial.front());
+   SignedLimbs atOne = valueAt(1);
+   SignedLimbs atMinusOne = valueAt(-1);
+   SignedLimbs atInfinity = SignedLimbs::multiply(lhsCoefficients.back(), rhsPolynomial.back());
+   std::vector<SignedLimbs> coefficients;   // the product polynomial's coefficients, lowest first
+
+   if (lhsPieces + rhsPieces == 5) {
+      // Degree 3: r1 + r3 = (v(1) - v(-1)) / 2 and r0 + r2 = (v(1) + v(-1)) / 2
+      SignedLimbs odd(atOne);
+      odd.add(atMinusOne, true);
+      odd.divideExactlyBySmall(2);
+      odd.add(atInfinity, true);
+      SignedLimbs even(atOne);
+      even.add(atMinusOne);
+      even.divideExactlyBySmall(2);
+      even.add(atZero, true);
+      coefficients = { atZero, odd, even, atInfinity };
+   } else {
+      // Degree 4: also evaluate at -2 and interpolate with Bodrato's sequence
+      SignedLimbs atMinusTwo = valueAt(-2);
+      SignedLimbs r3(atMinusTwo);          // (v(-2) - v(1)) / 3
+      r3.add(atOne, true);
+      r3.divideExactlyBySmall(3);
+      SignedLimbs r1(atOne);               // (v(1) - v(-1)) / 2
+      r1.add(atMinusOne, true);
+      r1.divideExactlyBySmall(2);
+      SignedLimbs r2(atMinusOne);          // v(-1) - v(0)
+      r2.add(atZero, true);
+      SignedLimbs twiceInfinity(atInfinity);
+      twiceInfinity.multiplyBySmall(2);
+      SignedLimbs r3Final(r2);             // (r2 - r3) / 2 + 2 v(inf)
+      r3Final.add(r3, true);
+      r3Final.divideExactlyBySmall(2);
+      r3Final.add(twiceInfinity);
+      r2.add(r1);                          // r2 + r1 - v(inf)
+      r2.add(atInfinity, true);
+      r1.add(r3Final, true);               // r1 - r3
+      coefficients = { atZero, r1, r2, r3Final, atInfinity };
+   }
+
+   // Every coefficient is non-negative, so they can be added into place one by one
+   const int productSize = lhsSize + rhsSize;
+   std::fill(product, product + productSize, 0);
+   for (int i = 0; i < static_cast<int>(coefficients.size()); ++i) {
+      const LimbVector& coefficient = coefficients[i].magnitude;
+      if (!coefficient.empty()) {
+         addLimbsInPlace(product + i * pieceSize, productSize - i * pieceSize,
+                         coefficient.data(), static_cast<int>(coefficient.size()));
+      }
+   }
+}
+
+/** powModPrime(std::uint32_t, unsigned long long, std::uint32_t)
+ * @brief   Raises a number to a power modulo a prime below 2^31.
+ * @param   base        The number to raise
+ * @param   exponent    The power to raise it to
+ * @param   prime       The modulus
+ * @return  base^exponent mod prime.
+*/
+std::uint32_t InfiniteInt::powModPrime(std::uint32_t base, unsigned long long exponent, std::uint32_t prime) {
+   unsigned long long result{1};
+   unsigned long long square = base % prime;
+   for (; exponent != 0; exponent >>= 1) {
+      if (exponent & 1) {
+         result = result * square % prime;
+      }
+      square = square * square % prime;
+   }
+   return static_cast<std::uint32_t>(result);
+}
+
+/** numberTheoreticTransform(std::vector<std::uint32_t>&, bool, std::uint32_t, std::uint32_t)
+ * @brief   Transforms values in place with an iterative radix-2 NTT, the exact
+ *          modular analogue of a fast Fourier transform.
+ * @param   values         The values to transform, each less than prime
+ * @param   inverse        Whether to apply the inverse transform
+ * @param   prime          A prime below 2^31 with values.size() dividing prime - 1
+ * @param   primitiveRoot  A primitive root modulo prime
+ * @pre     values.size() is a power of two.
+ * @post    values holds the (inverse) transform of its old contents modulo prime.
+*/
+void InfiniteInt::numberTheoreticTransform(std::vector<std::uint32_t>& values, bool inverse,
+                                           std::uint32_t prime, std::uint32_t primitiveRoot) {
+   const int size = static_cast<int>(values.size());
+
+   // Put the values in bit-reversed order so the butterflies can work in place
+   for (int i = 1, j = 0; i < size; ++i) {
+      int bit = size >> 1;
+      for (; j & bit; bit >>= 1) {
+         j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) {
+         std::swap(values[i], values[j]);
+      }
+   }
+
+   // Combine transforms of doubling length, each with its own root of unity
+   std::vector<std::uint32_t> twiddles;   // powers of this length's root of unity
+   for (int length = 2; length <= size; length <<= 1) {
+      const int half = length / 2;
+      std::uint32_t root = powModPrime(primitiveRoot, (prime - 1) / length, prime);
+      if (inverse) {
+         root = powModPrime(root, prime - 2, prime);
+      }
+      twiddles.assign(half, 1);
+      for (int k = 1; k < half; ++k) {
+         twiddles[k] = static_cast<std::uint32_t>(static_cast<unsigned long long>(twiddles[k - 1]) * root % prime);
+      }
+
+      for (int start = 0; start < size; start += length) {
+         for (int k = 0; k < half; ++k) {
+            std::uint32_t even = values[start + k];
+            std::uint32_t odd = static_cast<std::uint32_t>(
+               static_cast<unsigned long long>(values[start + k + half]) * twiddles[k] % prime);
+            values[start + k] = even + odd >= prime ? even + odd - prime : even + odd;
+            values[start + k + half] = even >= odd ? even - odd : even + prime - odd;
+         }
+      }
+   }
+
+   // The inverse transform also divides by the length
+   if (inverse) {
+      unsigned long long sizeInverse = powModPrime(static_cast<std::uint32_t>(size), prime - 2, prime);
+      for (std::uint32_t& value : values) {
+         value = static_cast<std::uint32_t>(value * sizeInverse % prime);
+      }
+   }
+}
+
+/** nttMultiply(const Limb*, int, const Limb*, int, Limb*)
+ * @brief   Multiplies two limb arrays exactly by convolving their limbs with
+ *          number theoretic transforms modulo three primes and recombining the
+ *          residues with the Chinese remainder theorem.
+ * @pre     As for multiplyLimbs, and lhsSize + rhsSize <= kMaxNttLength.
+ * @post    All lhsSize + rhsSize limbs of product have been written.
+*/
+void InfiniteInt::nttMultiply(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product) {
+   /* Each convolution term is below min(lhsSize, rhsSize) * kLimbBase^2 <= 2^25 * 2^64,
+      which is less than the product of the primes (about 2^90.5), so the residues
+      determine it exactly. Each prime supports transforms of length 2^26. */
+   const std::uint32_t primes[3] = { 2013265921u, 1811939329u, 469762049u };
+   const std::uint32_t primitiveRoots[3] = { 31u, 13u, 3u };
+
+   int transformSize{1};
+   while (transformSize < lhsSize + rhsSize - 1) {
+      transformSize <<= 1;
+   }
+
+   // Convolve the limbs modulo each prime (a square needs only one forward transform)
+   const bool squaring = lhs == rhs && lhsSize == rhsSize;
+   std::vector<std::uint32_t> residues[3];
+   std::vector<std::uint32_t> rhsValues;
+   for (int p = 0; p < 3; ++p) {
+      std::vector<std::uint32_t>& lhsValues = residues[p];
+      lhsValues.assign(transformSize, 0);
+      for (int i = 0; i < lhsSize; ++i) {
+         lhsValues[i] = lhs[i] % primes[p];
+      }
+      numberTheoreticTransform(lhsValues, false, primes[p], primitiveRoots[p]);
+      if (!squaring) {
+         rhsValues.assign(transformSize, 0);
+         for (int i = 0; i < rhsSize; ++i) {
+            rhsValues[i] = rhs[i] % primes[p];
+         }
+         numberTheoreticTransform(rhsValues, false, primes[p], primitiveRoots[p]);
+      }
+      const std::vector<std::uint32_t>& rhsTransform = squaring ? lhsValues : rhsValues;
+      for (int i = 0; i < transformSize; ++i) {
+         lhsValues[i] = static_cast<std::uint32_t>(static_cast<unsigned long long>(lhsValues[i]) * rhsTransform[i] % primes[p]);
+      }
+      numberTheoreticTransform(lhsValues, true, primes[p], primitiveRoots[p]);
+   }
+
+   // Recombine each term with Garner's algorithm and carry it into the product
+   const unsigned long long firstInverse = powModPrime(primes[0] % primes[1], primes[1] - 2, primes[1]);
+   const unsigned long long firstInverseThird = powModPrime(primes[0] % primes[2], primes[2] - 2, primes[2]);
+   const unsigned long long secondInverseThird = powModPrime(primes[1] % primes[2], primes[2] - 2, primes[2]);
+   const unsigned __int128 firstTwo = static_cast<unsigned __int128>(primes[0]) * primes[1];
+   unsigned __int128 carry{0};
+   for (int i = 0; i < lhsSize + rhsSize; ++i) {
+      if (i < lhsSize + rhsSize - 1) {
+         unsigned long long x1 = residues[0][i];
+         unsigned long long x2 = (residues[1][i] + primes[1] - x1 % primes[1]) % primes[1] * firstInverse % primes[1];
+         unsigned long long x3 = (residues[2][i] + primes[2] - x1 % primes[2]) % primes[2] * firstInverseThird % primes[2];
+         x3 = (x3 + primes[2] - x2 % primes[2]) % primes[2] * secondInverseThird % primes[2];
+         carry += x1 + static_cast<unsigned __int128>(x2) * primes[0] + x3 * firstTwo;
+      }
+      product[i] = static_cast<Limb>(carry % kLimbBase);
+      carry /= kLimbBase;
+   }
+}
+
+/** limbValue(int)
+ * @brief   Reads a limb stored in digits_.
+ * @param   entry    An entry of digits_
+ * @return  The limb stored in entry, in [0, kLimbBase).
+*/
+unsigned long long InfiniteInt::limbValue(int entry) {
+   // Binary limbs use all 32 bits of the entry, so read it back as unsigned
+   return static_cast<std::uint32_t>(entry);
+}
+
+/** limbEntry(unsigned long long)
+ * @brief   Converts a limb into the entry that stores it in digits_.
+ * @param   limb     A limb in [0, kLimbBase)
+ * @return  The entry to store in digits_.
+*/
+int InfiniteInt::limbEntry(unsigned long long limb) {
+   return static_cast<int>(static_cast<std::uint32_t>(limb));
+}
+
+/** decimalChunks(DEIntQueue&)
+ * @brief   Gives the magnitude of this InfiniteInt in base 10^kChunkDigits,
+ *          converting from binary limbs only if necessary.
+ * @param   scratch  Queue that receives the conversion when one is needed
+ * @post    If the limbs are binary, scratch holds the decimal chunks.
+ * @return  Reference to a queue of the decimal chunks (ordered from highest
+ *          to lowest): digits_ itself for decimal limbs, otherwise scratch.
+*/
+#ifdef INFINITEINT_BINARY
+const DEIntQueue& InfiniteInt::decimalChunks(DEIntQueue& scratch) const {
+   /* A number of n limbs is below 2^(32n), so it has at most 32n * log10(2) + 1
+      digits (log10(2) is rounded up here, so the bound never falls short) */
+   const LimbVector limbs = magnitudeLimbs();
+   const int size = static_cast<int>(limbs.size());
+   const long long maxDigits = static_cast<long long>(size) * 32 * 30103 / 100000 + 1;
+   const int numChunks = static_cast<int>((maxDigits + kChunkDigits - 1) / kChunkDigits);
+
+   // Convert by halves, then skip the leading zero chunks the bound left room for
+   LimbVector chunks(numChunks);
+   limbsToChunks(limbs.data(), size, chunkPowers(numChunks), numChunks, chunks.data());
+   int highest = numChunks - 1;
+   while (highest > 0 && chunks[highest] == 0) {
+      --highest;
+   }
+
+   scratch.clear();
+   scratch.reserve(highest + 1);
+   for (int i = highest; i >= 0; --i) {
+      scratch.pushBack(static_cast<int>(chunks[i]));
+   }
+   return scratch;
+}
+#else
+const DEIntQueue& InfiniteInt::decimalChunks(DEIntQueue&) const {
+   // Decimal limbs already are the chunks
+   return digits_;
+}
+#endif
+
+/** assignDecimalChunks(const LimbVector&, bool)
+ * @brief   Sets this InfiniteInt from its magnitude in base kChunkBase and a sign.
+ * @param   chunks      The magnitude in base kChunkBase, ordered from lowest
+ *                      chunk to highest (may have leading zero chunks)
+ * @param   negative    Whether the number is negative (ignored for zero)
+ * @post    This InfiniteInt represents the given number, inline if it fits.
+*/
+void InfiniteInt::assignDecimalChunks(const LimbVector& chunks, bool negative) {
+#ifdef INFINITEINT_BINARY
+   if (chunks.empty()) {
+      setSmall(0);
+      return;
+   }
+
+   /* Convert by halves, scaling the chunks above the lowest 2^j by kChunkBase^(2^j).
+      A number of n chunks is below 2^(32n), so n limbs always hold the result. */
+   const int size = static_cast<int>(chunks.size());
+   LimbVector limbs(size);
+   chunksToLimbs(chunks.data(), size, chunkPowers(size), limbs.data());
+   assignMagnitude(limbs, negative);
+#else
+   // A decimal chunk is exactly one limb
+   assignMagnitude(chunks, negative);
+#endif
+}
+
+#ifdef INFINITEINT_BINARY
+/** chunkPowers(int)
+ * @brief   Builds the powers of kChunkBase that split a number of some # of
+ *          chunks in halves, each the square of the one before.
+ * @param   size     # of chunks in the numbers to split
+ * @return  kChunkBase^(2^j) in binary limbs (ordered from lowest to highest,
+ *          without leading zero limbs) for every 2^j below size, and at least j = 0.
+*/
+std::vector<InfiniteInt::LimbVector> InfiniteInt::chunkPowers(int size) {
+   std::vector<LimbVector> powers(1, LimbVector(1, kChunkBase));
+   while ((2 << (powers.size() - 1)) < size) {
+      const LimbVector& last = powers.back();
+      LimbVector square(2 * last.size());
+      squareLimbs(last.data(), static_cast<int>(last.size()), square.data());
+      while (square.back() == 0) {
+         square.pop_back();
+      }
+      powers.push_back(std::move(square));
+   }
+   return powers;
+}
+
+/** chunksToLimbs(const Limb*, int, const std::vector<LimbVector>&, Limb*)
+ * @brief   Converts a magnitude from base kChunkBase to binary limbs, splitting
+ *          it in halves so that the large products use the fast multiplications.
+ * @param   chunks   The magnitude in base kChunkBase, ordered from lowest chunk to highest
+ * @param   size     # of chunks (at least 1)
+ * @param   powers   kChunkBase^(2^j) in binary limbs for every 2^j below size
+ * @param   limbs    Array to write the size-limb result to
+ * @pre     limbs has room for size limbs and does not overlap chunks.
+ * @post    All size limbs of limbs have been written.
+*/
+void InfiniteInt::chunksToLimbs(const Limb* chunks, int size, const std::vector<LimbVector>& powers, Limb* limbs) {
+   // Short runs are accumulated from the highest chunk down
+   if (size <= kChunkConversionLimbs) {
+      std::fill(limbs, limbs + size, 0);
+      int used{0};   // # of limbs of limbs in use so far
+      for (int i = size - 1; i >= 0; --i) {
+         unsigned long long carry = chunks[i];
+         for (int j = 0; j < used; ++j) {
+            unsigned long long current = limbs[j] * static_cast<unsigned long long>(kChunkBase) + carry;
+            limbs[j] = static_cast<Limb>(current);
+            carry = current >> 32;
+         }
+         if (carry != 0) {
+            limbs[used++] = static_cast<Limb>(carry);
+         }
+      }
+      return;
+   }
+
+   // Split off the lowest 2^j chunks, the largest power of two below size
+   int level{0};
+   while ((2 << level) < size) {
+      ++level;
+   }
+   const int lowSize = 1 << level;
+   const int highSize = size - lowSize;
+   const LimbVector& power = powers[level];
+   const int powerSize = static_cast<int>(power.size());
+
+   chunksToLimbs(chunks, lowSize, powers, limbs);
+   std::fill(limbs + lowSize, limbs + size, 0);
+   LimbVector high(highSize);
+   chunksToLimbs(chunks + lowSize, highSize, powers, high.data());
+   LimbVector product(highSize + powerSize);
+   multiplyLimbs(high.data(), highSize, power.data(), powerSize, product.data());
+
+   // The whole number fits in size limbs, so the product's higher limbs are zero
+   addLimbsInPlace(limbs, size, product.data(), std::min(size, highSize + powerSize));
+}
+
+/** limbsToChunks(const Limb*, int, const std::vector<LimbVector>&, int, Limb*)
+ * @brief   Converts a magnitude from binary limbs to base kChunkBase, splitting
+ *          it in halves so that the large quotients use the fast divisions.
+ * @param   limbs    The magnitude in binary limbs, ordered from lowest limb to highest
+ *                   (may have leading zero limbs)
+ * @param   size     # of limbs in limbs
+ * @param   powers   kChunkBase^(2^j) in binary limbs for every 2^j below numChunks
+ * @param   numChunks   # of chunks to write
+ * @param   chunks   Array to write the chunks to, ordered from lowest chunk to highest
+ * @pre     The magnitude is below kChunkBase^numChunks, numChunks >= 1 and chunks
+ *          has room for numChunks chunks.
+ * @post    All numChunks chunks of chunks have been written, the highest ones
+ *          possibly 0.
+*/
+void InfiniteInt::limbsToChunks(const Limb* limbs, int size, const std::vector<LimbVector>& powers,
+                                int numChunks, Limb* chunks) {
+   while (size > 0 && limbs[size - 1] == 0) {
+      --size;
+   }
+
+   // Short runs are peeled off one chunk at a time, starting with the lowest
+   if (numChunks <= kChunkConversionLimbs) {
+      LimbVector magnitude(limbs, limbs + size);
+      for (int i = 0; i < numChunks; ++i) {
+         chunks[i] = size == 0 ? 0 : divideLimbsBySmall(magnitude.data(), size, kChunkBase, magnitude.data());
+         while (size > 0 && magnitude[size - 1] == 0) {
+            --size;
+         }
+      }
+      return;
+   }
+
+   // Split off the lowest 2^j chunks, the largest power of two below numChunks
+   int level{0};
+   while ((2 << level) < numChunks) {
+      ++level;
+   }
+   const int lowChunks = 1 << level;
+   const LimbVector& power = powers[level];
+   const int powerSize = static_cast<int>(power.size());
+
+   // Numbers shorter than the power are all low part
+   if (size < powerSize) {
+      limbsToChunks(limbs, size, powers, lowChunks, chunks);
+      std::fill(chunks + lowChunks, chunks + numChunks, 0);
+      return;
+   }
+
+   LimbVector high(size - powerSize + 1);
+   LimbVector low(powerSize);
+   divideLimbs(limbs, size, power.data(), powerSize, high.data(), low.data());
+   limbsToChunks(low.data(), powerSize, powers, lowChunks, chunks);
+   limbsToChunks(high.data(), static_cast<int>(high.size()), powers, numChunks - lowChunks, chunks + lowChunks);
+}
+#endif
+
+/** bufferedCount(std::streambuf*)
+ * @brief   Counts the characters waiting in a stream buffer's get area.
+ * @param   buffer   The stream buffer to check
+ * @return  egptr() - gptr() for buffer, which is 0 for a buffer without a get area.
+*/
+std::streamsize InfiniteInt::bufferedCount(std::streambuf* buffer) {
+   // The get area pointers are protected, but a derived class may name them for any buffer
+   struct GetArea : std::streambuf {
+      static std::streamsize count(std::streambuf* buffer) {
+         return (buffer->*&GetArea::egptr)() - (buffer->*&GetArea::gptr)();
+      }
+   };
+   return GetArea::count(buffer);
+}
+
+/** digitRunLength(const char*, int)
+ * @brief   Finds how many characters at the start of some text are digits.
+ * @param   text     The characters to scan
+ * @param   size     # of characters in text
+ * @return  The length of the run of '0' - '9' that text starts with.
+*/
+int InfiniteInt::digitRunLength(const char* text, int size) {
+   /* Check eight characters at a time: subtracting '0' sets a byte's top bit
+      below '0', and adding 0x46 sets it above '9'. The lowest non-digit byte
+      has no borrow or carry coming in, so a word of digits never flags. */
+   int length{0};
+   for (; length + 8 <= size; length += 8) {
+      unsigned long long word{0};
+      std::memcpy(&word, text + length, sizeof(word));
+      if (((word - 0x3030303030303030ULL) | (word + 0x4646464646464646ULL)) & 0x8080808080808080ULL) {
+         break;
+      }
+   }
+   while (length < size && text[length] >= '0' && text[length] <= '9') {
+      ++length;
+   }
+   return length;
+}
+
+/** eightDigitsValue(const char*)
+ * @brief   Converts eight decimal digits to their value at once.
+ * @param   digits   The digits, highest first
+ * @pre     All eight characters are '0' - '9'.
+ * @return  The value of the digits, in [0, 10^8).
+*/
+InfiniteInt::Limb InfiniteInt::eightDigitsValue(const char* digits) {
+   // Pack the digits with the highest in the lowest byte, whatever the byte order
+   unsigned long long word{0};
+   for (int i = 7; i >= 0; --i) {
+      word = (word << 8) | static_cast<unsigned char>(digits[i] - '0');
+   }
+
+   // Combine neighbouring digits, then pairs, then quadruples, each with one multiply
+   word = ((word * 10) + (word >> 8)) & 0x00FF00FF00FF00FFULL;
+   word = ((word * 100) + (word >> 16)) & 0x0000FFFF0000FFFFULL;
+   word = (word * 10000) + (word >> 32);
+   return static_cast<Limb>(word & 0xFFFFFFFFULL);
+}
+
+/** removeLeadingZeroes()
+ * @brief   Removes any leading zero limbs from this InfiniteInt.
+ * @post    All leading zero limbs, other than the lowest limb, have been removed from this InfiniteInt.
+*/
+void InfiniteInt::removeLeadingZeroes() {
+   while ((digits_.numEntries() > 1) && (digits_.front() == 0)) {   // Don't remove the lowest limb
+      digits_.popFront();
+   }
+}
+
+/** operator<<(ostream&, const InfiniteInt&)
+ * @brief   Outputs a InfiniteInt to an output stream
+ * @param   outStream      The stream to print the queue's entries to
+ * @param   IIToPrint      The InfiniteInt whose entries are being printed
+ * @pre     outStream is not in an error state when the function is called
+ * @post    A textual representation of the number represented by this InfiniteInt
+ *          has been output to outStream.
+ * @return  Reference to the modified stream.
+*/
+std::ostream& operator<<(std::ostream& outStream, const InfiniteInt& IIToPrint) {
+   // Output minus sign, if necessary
+   if (IIToPrint.isNegative_) {
+      outStream << '-';
+   }
+
+   // Inline numbers print their magnitude directly
+   if (IIToPrint.isSmall_) {
+      long long value = IIToPrint.small_;
+      outStream << static_cast<unsigned long long>(value < 0 ? -value : value);
+      return outStream;
+   }
+
+   DEIntQueue scratch;                          // Decimal chunks, if the limbs are binary
+   const DEIntQueue& chunks = IIToPrint.decimalChunks(scratch);
+
+   // Output the highest chunk as is
+   auto iter = chunks.begin();
+   outStream << *iter;
+
+   // Output the remaining chunks, from highest to lowest, each padded with leading zeroes
+   // to exactly kChunkDigits digits (written directly so the stream's width/fill are untouched)
+   char chunkText[InfiniteInt::kChunkDigits];   // The digits of the current chunk
+   for (++iter; iter != chunks.end(); ++iter) {
+      int chunk = *iter;
+      for (int i = InfiniteInt::kChunkDigits - 1; i >= 0; --i) {
+         chunkText[i] = static_cast<char>('0' + chunk % 10);
+         chunk /= 10;
+      }
+      outStream.write(chunkText, InfiniteInt::kChunkDigits);
+   }
+
+   // Return stream
+   return outStream;
 }
 
 /** operator>>(istream&, const InfiniteInt&)
@@ -463,51 +3955,111 @@ std::ostream& operator<<(std::ostream& outStream, const InfiniteInt& IIToPrint)
  *          order in which they were read. If the first character was '-' followed
  *          by at least one digit, then the InfiniteInt has been set to be negative
  *          and all consecutive digits have been read and stored, as before. In
- *          all other cases, the InfiniteInt is set to zero.
+ *          all other cases, the InfiniteInt is set to zero. Reaching the end
+ *          of the stream sets eofbit, and failbit as well if it was reached
+ *          before any character other than whitespace.
  * @return  Reference to the modified stream.
 */
 std::istream& operator>>(std::istream& inStream, InfiniteInt& IIToFill) {
-   // Reset the InfiniteInt
-   IIToFill.digits_.clear();
-   IIToFill.isNegative_ = false;
+   // Discard leading whitespace; a stream with nothing left fails
+   std::istream::sentry sentry(inStream);
+   if (!sentry) {
+      IIToFill.setSmall(0);
+      return inStream;
+   }
 
-   // Discard leading whitespace
-   inStream >> std::ws;
+   /* Read straight from the stream's buffer, which costs no virtual call
+      while the buffer holds characters. */
+   std::streambuf* buffer = inStream.rdbuf();
+   const int kEnd = std::char_traits<char>::eof();
+   const int kReadBlockSize = 4096;   // most characters taken from the buffer at once
+   int current = buffer->sgetc();   // the next character, not yet taken from the buffer
 
    // Check for minus sign
-   if (inStream.peek() == '-') {
-      IIToFill.isNegative_ = true;
-      inStream.ignore(1);  // remove '-' from the stream
+   bool negative{false};
+   if (current == '-') {
+      negative = true;
+      current = buffer->snextc();
    }
 
    // Discard any leading zeroes
-   while (inStream.peek() == '0') {
-      inStream.ignore(1);
+   bool readZero{false};
+   while (current == '0') {
+      readZero = true;
+      current = buffer->snextc();
    }
 
-   // Read in digits and store them
-   char currentChar;    // latest character read from the stream
-   while (inStream.get(currentChar)) {
-      if (std::isdigit(currentChar)) {
-         IIToFill.digits_.pushBack(currentChar - '0');
-      } else {
-         // Not a digit - put it back in the stream and stop reading
-         inStream.putback(currentChar);
-         break;
+   /* Read in digits a block at a time while the buffer's get area holds them.
+      A block never reaches past the get area, so the characters after the
+      digits can always be put back. */
+   std::string digitText;  // The digits read from the stream, highest first
+   char block[kReadBlockSize];
+   while (current >= '0' && current <= '9') {
+      const std::streamsize available = std::min<std::streamsize>(InfiniteInt::bufferedCount(buffer), kReadBlockSize);
+      if (available <= 1) {
+         // Nothing buffered past this digit - take it alone and let the buffer refill
+         digitText.push_back(static_cast<char>(current));
+         current = buffer->snextc();
+         continue;
+      }
+
+      const int numTaken = static_cast<int>(buffer->sgetn(block, available));
+      const int numDigits = InfiniteInt::digitRunLength(block, numTaken);
+      if (numDigits == numTaken && digitText.empty()) {
+         // A long number - make room once for everything else the buffer holds
+         digitText.reserve(numTaken + static_cast<std::size_t>(std::max<std::streamsize>(buffer->in_avail(), 0)));
+      }
+      digitText.append(block, numDigits);
+      for (int i = numTaken; i > numDigits; --i) {
+         if (buffer->sputbackc(block[i - 1]) == kEnd) {
+            inStream.setstate(std::ios_base::badbit);
+            break;
+         }
       }
+      current = buffer->sgetc();
+   }
+   if (current == kEnd) {
+      inStream.setstate(std::ios_base::eofbit);
    }
 
    // If no digits were read from inStream, set the InfiniteInt to zero
-   if (IIToFill.digits_.numEntries() == 0) {
-      IIToFill.digits_.pushBack(0);
-      
-      /* Check whether a leading '-' was read from inStream.
-         If so, put it back and set IIToFill to be positive. */
-      if (IIToFill.isNegative_) {
-         inStream.putback('-');
-         IIToFill.isNegative_ = false;
+   const int numRead = static_cast<int>(digitText.size());   // # of digits read
+   if (numRead == 0) {
+      // A lone '-' is not part of a number, so return it to the stream
+      if (negative && !readZero && buffer->sputbackc('-') == kEnd) {
+         inStream.setstate(std::ios_base::badbit);
       }
+      IIToFill.setSmall(0);
+      return inStream;
+   }
+
+   /* Split the digits into chunks of kChunkDigits, starting from the lowest.
+      The highest chunk takes the odd digits so that every other chunk is full;
+      a full chunk is its first digit then eight converted at once. */
+   const int numChunks = (numRead + InfiniteInt::kChunkDigits - 1) / InfiniteInt::kChunkDigits;
+   InfiniteInt::LimbVector chunks(numChunks);
+   const char* digits = digitText.data() + numRead;   // end of the lowest chunk not yet converted
+   for (int i = 0; i < numChunks - 1; ++i) {
+      digits -= InfiniteInt::kChunkDigits;
+      chunks[i] = static_cast<InfiniteInt::Limb>(digits[0] - '0') * 100000000 +
+                  InfiniteInt::eightDigitsValue(digits + 1);
    }
+   InfiniteInt::Limb highest{0};   // The value of the highest chunk's digits
+   for (const char* cur = digitText.data(); cur != digits; ++cur) {
+      highest = highest * 10 + static_cast<InfiniteInt::Limb>(*cur - '0');
+   }
+   chunks[numChunks - 1] = highest;
+   IIToFill.assignDecimalChunks(chunks, negative);
 
    return inStream;
+}
+
+/** swap(InfiniteInt&, InfiniteInt&)
+ * @brief   Exchanges the integers represented by two InfiniteInts in O(1).
+ * @param   lhs   The first InfiniteInt
+ * @param   rhs   The second InfiniteInt
+ * @post    lhs represents rhs's former integer and vice versa.
+*/
+void swap(InfiniteInt& lhs, InfiniteInt& rhs) noexcept {
+   lhs.swap(rhs);
 }
\ No newline at end of file
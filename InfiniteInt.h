@@ -6,15 +6,27 @@
  * @date 11/23/2020
 */
 
-#include "DEIntQueue.h" // Data structure used to store the list of digits
+#ifndef INFINITEINT_H
+#define INFINITEINT_H
+
+#include "DEIntQueue.h" // Data structure used to store the list of limbs
 #include <climits>      // INT_MIN and INT_MAX
+#include <cstdint>      // std::uint32_t
+#include <limits>       // std::numeric_limits
+#include <type_traits>  // std::is_integral and std::is_signed
+#include <vector>       // std::vector
+
+/* Limb storage is chosen at compile time. By default every limb holds nine
+   decimal digits (base 10^9), which keeps printing and numDigits() linear.
+   Defining INFINITEINT_BINARY stores binary limbs (base 2^32) instead, which
+   makes arithmetic cheaper and converts to decimal only when printing. */
 
 class InfiniteInt {
 public:
    //PUBLIC METHODS
    /** InfiniteInt()
     * @brief   Default constructor.
-    * @post    This InfiniteInt has a single digit, 0, and negative is false.
+    * @post    This InfiniteInt represents 0, held inline.
    */
    InfiniteInt();
 
@@ -25,6 +37,104 @@ public:
    */
    explicit InfiniteInt(int num);
 
+   /** InfiniteInt(unsigned)
+    * @brief   Constructs an InfiniteInt that represents the given integer.
+    * @param   num   The integer to be converted to an InfiniteInt
+    * @post    This InfiniteInt represents num.
+   */
+   explicit InfiniteInt(unsigned num);
+
+   /** InfiniteInt(long)
+    * @brief   Constructs an InfiniteInt that represents the given integer.
+    * @param   num   The integer to be converted to an InfiniteInt
+    * @post    This InfiniteInt represents num.
+   */
+   explicit InfiniteInt(long num);
+
+   /** InfiniteInt(unsigned long)
+    * @brief   Constructs an InfiniteInt that represents the given integer.
+    * @param   num   The integer to be converted to an InfiniteInt
+    * @post    This InfiniteInt represents num.
+   */
+   explicit InfiniteInt(unsigned long num);
+
+   /** InfiniteInt(long long)
+    * @brief   Constructs an InfiniteInt that represents the given integer,
+    *          writing its limbs directly.
+    * @param   num   The integer to be converted to an InfiniteInt (LLONG_MIN included)
+    * @post    This InfiniteInt represents num.
+   */
+   explicit InfiniteInt(long long num);
+
+   /** InfiniteInt(unsigned long long)
+    * @brief   Constructs an InfiniteInt that represents the given integer,
+    *          writing its limbs directly.
+    * @param   num   The integer to be converted to an InfiniteInt
+    * @post    This InfiniteInt represents num.
+   */
+   explicit InfiniteInt(unsigned long long num);
+
+   /** InfiniteInt(__int128)
+    * @brief   Constructs an InfiniteInt that represents the given 128-bit
+    *          integer, writing its limbs directly.
+    * @param   num   The integer to be converted to an InfiniteInt
+    * @post    This InfiniteInt represents num.
+   */
+   explicit InfiniteInt(__int128 num);
+
+   /** InfiniteInt(double)
+    * @brief   Constructs an InfiniteInt that represents the integer part of a
+    *          floating point number exactly.
+    * @param   num   The number to be converted, truncated toward zero
+    * @pre     num is finite.
+    * @post    This InfiniteInt represents num with its fraction dropped. Large
+    *          doubles convert to every digit of their exact binary value.
+    * @throw   std::domain_error if num is infinite or NaN.
+   */
+   explicit InfiniteInt(double num);
+
+   /** InfiniteInt(const InfiniteInt&)
+    * @brief   Copy constructor.
+    * @param   toCopy   The InfiniteInt being copied
+    * @post    This InfiniteInt represents the same integer as toCopy, with its own
+    *          copy of the digits.
+   */
+   InfiniteInt(const InfiniteInt& toCopy) = default;
+
+   /** operator=(const InfiniteInt&)
+    * @brief   Assignment operator.
+    * @param   toCopy   The InfiniteInt being copied
+    * @post    This InfiniteInt represents the same integer as toCopy, with its own
+    *          copy of the digits.
+    * @return  Reference to this InfiniteInt.
+   */
+   InfiniteInt& operator=(const InfiniteInt& toCopy) = default;
+
+   /** InfiniteInt(InfiniteInt&&)
+    * @brief   Move constructor. Takes over another InfiniteInt's digits without copying.
+    * @param   toMove   The InfiniteInt being moved from
+    * @post    This InfiniteInt represents the integer toMove represented. toMove
+    *          represents 0.
+   */
+   InfiniteInt(InfiniteInt&& toMove) noexcept;
+
+   /** operator=(InfiniteInt&&)
+    * @brief   Move assignment operator. Exchanges digits with another InfiniteInt
+    *          instead of copying them.
+    * @param   toMove   The InfiniteInt being moved from
+    * @post    This InfiniteInt represents the integer toMove represented. toMove
+    *          represents the integer this InfiniteInt held before.
+    * @return  Reference to this InfiniteInt.
+   */
+   InfiniteInt& operator=(InfiniteInt&& toMove) noexcept;
+
+   /** swap(InfiniteInt&)
+    * @brief   Exchanges the integers represented by this InfiniteInt and another in O(1).
+    * @param   other    The InfiniteInt to exchange with
+    * @post    This InfiniteInt represents other's former integer and vice versa.
+   */
+   void swap(InfiniteInt& other) noexcept;
+
    /** operator int()
     * @brief   Conversion operator. Returns the number represented by this
     *          InfiniteInt as an integer.
@@ -38,6 +148,37 @@ public:
    */
    operator int() const;
 
+   /** toInt64(long long&)
+    * @brief   Converts this InfiniteInt to a long long if it fits, without
+    *          throwing or allocating.
+    * @param   value    Set to the number represented by this InfiniteInt, if it fits
+    * @post    If the number is in [LLONG_MIN, LLONG_MAX], value equals it.
+    *          Otherwise value is unchanged.
+    * @return  True if the number fit in a long long and false otherwise.
+   */
+   bool toInt64(long long& value) const;
+
+   /** toUint64(unsigned long long&)
+    * @brief   Converts this InfiniteInt to an unsigned long long if it fits,
+    *          without throwing or allocating.
+    * @param   value    Set to the number represented by this InfiniteInt, if it fits
+    * @post    If the number is in [0, ULLONG_MAX], value equals it. Otherwise
+    *          value is unchanged.
+    * @return  True if the number fit in an unsigned long long and false otherwise.
+   */
+   bool toUint64(unsigned long long& value) const;
+
+   /** tryConvert(T&)
+    * @brief   Converts this InfiniteInt to any built-in integer type of up to
+    *          64 bits if it fits, without throwing or allocating.
+    * @param   value    Set to the number represented by this InfiniteInt, if it fits
+    * @post    If the number is within T's range, value equals it. Otherwise
+    *          value is unchanged.
+    * @return  True if the number fit in a T and false otherwise.
+   */
+   template <typename T>
+   bool tryConvert(T& value) const;
+
    /** numDigits()
     * @brief   Returns the number of decimal digits in the number represented
     *          by this InfiniteInt.
@@ -78,6 +219,265 @@ public:
    */
    InfiniteInt operator*(const InfiniteInt& rhs) const;
 
+   /** operator+=(const InfiniteInt&)
+    * @brief   Adds the number represented by another InfiniteInt to this one, in place.
+    * @param   rhs   The InfiniteInt to add to this one (may be this InfiniteInt)
+    * @post    This InfiniteInt represents the sum of its old number and rhs's. Its
+    *          limbs have been updated in place, growing only if a carry spills over.
+    * @return  Reference to this InfiniteInt.
+   */
+   InfiniteInt& operator+=(const InfiniteInt& rhs);
+
+   /** operator-=(const InfiniteInt&)
+    * @brief   Subtracts the number represented by another InfiniteInt from this one, in place.
+    * @param   rhs   The InfiniteInt to subtract from this one (may be this InfiniteInt)
+    * @post    This InfiniteInt represents the difference of its old number and rhs's.
+    *          Its limbs have been updated in place, growing only if a carry spills over.
+    * @return  Reference to this InfiniteInt.
+   */
+   InfiniteInt& operator-=(const InfiniteInt& rhs);
+
+   /** operator*=(const InfiniteInt&)
+    * @brief   Multiplies this InfiniteInt by the number represented by another.
+    * @param   rhs   The InfiniteInt to multiply this one by (may be this InfiniteInt)
+    * @post    This InfiniteInt represents the product of its old number and rhs's,
+    *          reusing its limb storage where it is large enough.
+    * @return  Reference to this InfiniteInt.
+   */
+   InfiniteInt& operator*=(const InfiniteInt& rhs);
+
+   /** square()
+    * @brief   Squares the number represented by this InfiniteInt and returns the
+    *          result as an InfiniteInt. Squaring skips the repeated limb products
+    *          a general multiplication would compute, so it is faster than
+    *          multiplying by a copy (operator* also squares when given this
+    *          InfiniteInt itself).
+    * @post    The returned InfiniteInt represents the square of this InfiniteInt's number.
+    * @return  InfiniteInt representing the square.
+   */
+   InfiniteInt square() const;
+
+   /** pow(unsigned)
+    * @brief   Raises the number represented by this InfiniteInt to a power and
+    *          returns the result as an InfiniteInt. The power is built by binary
+    *          exponentiation, squaring once per bit of the exponent, so it takes
+    *          about log2(exponent) steps rather than exponent multiplications.
+    * @param   exponent   The power to raise this InfiniteInt's number to
+    * @post    The returned InfiniteInt represents this InfiniteInt's number raised
+    *          to exponent (1 if exponent is 0, including for zero).
+    * @return  InfiniteInt representing the power.
+    * @throw   std::length_error if the power would have more limbs than an int can count.
+   */
+   InfiniteInt pow(unsigned exponent) const;
+
+   /** gcd(const InfiniteInt&)
+    * @brief   Returns the greatest common divisor of the numbers represented by
+    *          this InfiniteInt and another. Numbers that fit in a machine word use
+    *          binary GCD; longer ones run Lehmer's algorithm, which finds many
+    *          Euclidean steps at once from the leading limbs, and the longest are
+    *          first shortened by a subquadratic half-GCD.
+    * @param   other   The InfiniteInt to take the gcd with
+    * @return  InfiniteInt representing the gcd. It is never negative, and is 0
+    *          only if both numbers are 0.
+   */
+   InfiniteInt gcd(const InfiniteInt& other) const;
+
+   /** lcm(const InfiniteInt&)
+    * @brief   Returns the least common multiple of the numbers represented by
+    *          this InfiniteInt and another.
+    * @param   other   The InfiniteInt to take the lcm with
+    * @return  InfiniteInt representing the lcm. It is never negative, and is 0
+    *          if either number is 0.
+   */
+   InfiniteInt lcm(const InfiniteInt& other) const;
+
+   /** extendedGcd(const InfiniteInt&, InfiniteInt&, InfiniteInt&)
+    * @brief   Returns the greatest common divisor of the numbers represented by
+    *          this InfiniteInt and another, along with Bezout coefficients.
+    * @param   other   The InfiniteInt to take the gcd with
+    * @param   x       Set to the coefficient of this InfiniteInt's number
+    * @param   y       Set to the coefficient of other's number
+    * @pre     x and y are different InfiniteInts (either may be this InfiniteInt or other).
+    * @post    *this * x + other * y equals the gcd. If other is not 0, |x| is at
+    *          most |other| / (2 * gcd); otherwise x is -1, 0 or 1 and y is 0.
+    * @return  InfiniteInt representing the gcd, as given by gcd().
+   */
+   InfiniteInt extendedGcd(const InfiniteInt& other, InfiniteInt& x, InfiniteInt& y) const;
+
+   /** operator/(const InfiniteInt&)
+    * @brief   Divides the number represented by this InfiniteInt by that represented
+    *          by another and returns the quotient, truncated toward zero.
+    * @param   rhs   The InfiniteInt to divide this one by
+    * @pre     rhs does not represent zero.
+    * @post    The returned InfiniteInt represents this InfiniteInt's number divided
+    *          by rhs's, with any fraction discarded.
+    * @return  InfiniteInt representing the truncated quotient.
+    * @throw   std::domain_error if rhs represents zero.
+   */
+   InfiniteInt operator/(const InfiniteInt& rhs) const;
+
+   /** operator%(const InfiniteInt&)
+    * @brief   Returns the remainder of dividing the number represented by this
+    *          InfiniteInt by that represented by another.
+    * @param   rhs   The InfiniteInt to divide this one by
+    * @pre     rhs does not represent zero.
+    * @post    The returned InfiniteInt has the sign of this InfiniteInt's number
+    *          (or is zero) and a magnitude less than rhs's, so that
+    *          (*this / rhs) * rhs + *this % rhs == *this.
+    * @return  InfiniteInt representing the remainder.
+    * @throw   std::domain_error if rhs represents zero.
+   */
+   InfiniteInt operator%(const InfiniteInt& rhs) const;
+
+   /** operator/=(const InfiniteInt&)
+    * @brief   Divides this InfiniteInt by the number represented by another,
+    *          truncating toward zero.
+    * @param   rhs   The InfiniteInt to divide this one by (may be this InfiniteInt)
+    * @pre     rhs does not represent zero.
+    * @post    This InfiniteInt represents the truncated quotient.
+    * @return  Reference to this InfiniteInt.
+    * @throw   std::domain_error if rhs represents zero.
+   */
+   InfiniteInt& operator/=(const InfiniteInt& rhs);
+
+   /** operator%=(const InfiniteInt&)
+    * @brief   Replaces this InfiniteInt with the remainder of dividing it by the
+    *          number represented by another.
+    * @param   rhs   The InfiniteInt to divide this one by (may be this InfiniteInt)
+    * @pre     rhs does not represent zero.
+    * @post    This InfiniteInt represents the remainder, as given by operator%.
+    * @return  Reference to this InfiniteInt.
+    * @throw   std::domain_error if rhs represents zero.
+   */
+   InfiniteInt& operator%=(const InfiniteInt& rhs);
+
+   /** divmod(const InfiniteInt&, InfiniteInt&, InfiniteInt&)
+    * @brief   Divides the number represented by this InfiniteInt by that represented
+    *          by another, producing the quotient and remainder in a single division.
+    * @param   divisor     The InfiniteInt to divide this one by
+    * @param   quotient    Set to the quotient, truncated toward zero
+    * @param   remainder   Set to the remainder, which has the sign of this InfiniteInt
+    * @pre     divisor does not represent zero, and quotient and remainder are
+    *          different InfiniteInts (either may be this InfiniteInt or divisor).
+    * @post    quotient and remainder hold the same values as *this / divisor and
+    *          *this % divisor.
+    * @throw   std::domain_error if divisor represents zero.
+   */
+   void divmod(const InfiniteInt& divisor, InfiniteInt& quotient, InfiniteInt& remainder) const;
+
+   /** operator*(long long)
+    * @brief   Multiplies the number represented by this InfiniteInt by a machine
+    *          integer in a single pass and returns the result as an InfiniteInt.
+    * @param   rhs   The integer to multiply this InfiniteInt by
+    * @post    The returned InfiniteInt represents the product of this InfiniteInt's
+    *          number and rhs.
+    * @return  InfiniteInt representing the product.
+   */
+   InfiniteInt operator*(long long rhs) const;
+
+   /** operator*(int)
+    * @brief   Multiplies the number represented by this InfiniteInt by an int
+    *          (see operator*(long long)).
+    * @param   rhs   The integer to multiply this InfiniteInt by
+    * @return  InfiniteInt representing the product.
+   */
+   InfiniteInt operator*(int rhs) const;
+
+   /** operator*=(long long)
+    * @brief   Multiplies this InfiniteInt by a machine integer in place, in a single pass.
+    * @param   rhs   The integer to multiply this InfiniteInt by
+    * @post    This InfiniteInt represents the product of its old number and rhs.
+    * @return  Reference to this InfiniteInt.
+   */
+   InfiniteInt& operator*=(long long rhs);
+
+   /** operator*=(int)
+    * @brief   Multiplies this InfiniteInt by an int in place (see operator*=(long long)).
+    * @param   rhs   The integer to multiply this InfiniteInt by
+    * @return  Reference to this InfiniteInt.
+   */
+   InfiniteInt& operator*=(int rhs);
+
+   /** operator/(long long)
+    * @brief   Divides the number represented by this InfiniteInt by a machine
+    *          integer in a single pass and returns the quotient, truncated toward zero.
+    * @param   rhs   The integer to divide this InfiniteInt by
+    * @pre     rhs is not 0.
+    * @post    The returned InfiniteInt is the same as *this / InfiniteInt(rhs).
+    * @return  InfiniteInt representing the truncated quotient.
+    * @throw   std::domain_error if rhs is 0.
+   */
+   InfiniteInt operator/(long long rhs) const;
+
+   /** operator/(int)
+    * @brief   Divides the number represented by this InfiniteInt by an int
+    *          (see operator/(long long)).
+    * @param   rhs   The integer to divide this InfiniteInt by
+    * @return  InfiniteInt representing the truncated quotient.
+    * @throw   std::domain_error if rhs is 0.
+   */
+   InfiniteInt operator/(int rhs) const;
+
+   /** operator/=(long long)
+    * @brief   Divides this InfiniteInt by a machine integer in place, in a single
+    *          pass, truncating toward zero.
+    * @param   rhs   The integer to divide this InfiniteInt by
+    * @pre     rhs is not 0.
+    * @post    This InfiniteInt represents the truncated quotient.
+    * @return  Reference to this InfiniteInt.
+    * @throw   std::domain_error if rhs is 0.
+   */
+   InfiniteInt& operator/=(long long rhs);
+
+   /** operator/=(int)
+    * @brief   Divides this InfiniteInt by an int in place (see operator/=(long long)).
+    * @param   rhs   The integer to divide this InfiniteInt by
+    * @return  Reference to this InfiniteInt.
+    * @throw   std::domain_error if rhs is 0.
+   */
+   InfiniteInt& operator/=(int rhs);
+
+   /** operator%(long long)
+    * @brief   Returns the remainder of dividing the number represented by this
+    *          InfiniteInt by a machine integer, found in a single pass without
+    *          building the quotient.
+    * @param   rhs   The integer to divide this InfiniteInt by
+    * @pre     rhs is not 0.
+    * @post    The returned InfiniteInt is the same as *this % InfiniteInt(rhs).
+    * @return  InfiniteInt representing the remainder.
+    * @throw   std::domain_error if rhs is 0.
+   */
+   InfiniteInt operator%(long long rhs) const;
+
+   /** operator%(int)
+    * @brief   Returns the remainder of dividing the number represented by this
+    *          InfiniteInt by an int (see operator%(long long)).
+    * @param   rhs   The integer to divide this InfiniteInt by
+    * @return  InfiniteInt representing the remainder.
+    * @throw   std::domain_error if rhs is 0.
+   */
+   InfiniteInt operator%(int rhs) const;
+
+   /** operator%=(long long)
+    * @brief   Replaces this InfiniteInt with the remainder of dividing it by a
+    *          machine integer (see operator%(long long)).
+    * @param   rhs   The integer to divide this InfiniteInt by
+    * @pre     rhs is not 0.
+    * @post    This InfiniteInt represents the remainder.
+    * @return  Reference to this InfiniteInt.
+    * @throw   std::domain_error if rhs is 0.
+   */
+   InfiniteInt& operator%=(long long rhs);
+
+   /** operator%=(int)
+    * @brief   Replaces this InfiniteInt with the remainder of dividing it by an int
+    *          (see operator%=(long long)).
+    * @param   rhs   The integer to divide this InfiniteInt by
+    * @return  Reference to this InfiniteInt.
+    * @throw   std::domain_error if rhs is 0.
+   */
+   InfiniteInt& operator%=(int rhs);
+
    /** operator==(const InfiniteInt& rhs)
     * @brief   Equality operator. Checks if this InfiniteInt represents the same integer
     *          as another.
@@ -108,12 +508,292 @@ public:
    */
    bool operator<(const InfiniteInt& rhs) const;
 
+   /** operator<=(const InfiniteInt& rhs)
+    * @brief   Less-than-or-equal operator.
+    * @param   rhs   The InfiniteInt being compared to.
+    * @return  True if this InfiniteInt is less than or equal to rhs and false otherwise.
+   */
+   bool operator<=(const InfiniteInt& rhs) const;
+
+   /** operator>(const InfiniteInt& rhs)
+    * @brief   Greater-than operator.
+    * @param   rhs   The InfiniteInt being compared to.
+    * @return  True if this InfiniteInt is greater than rhs and false otherwise.
+   */
+   bool operator>(const InfiniteInt& rhs) const;
+
+   /** operator>=(const InfiniteInt& rhs)
+    * @brief   Greater-than-or-equal operator.
+    * @param   rhs   The InfiniteInt being compared to.
+    * @return  True if this InfiniteInt is greater than or equal to rhs and false otherwise.
+   */
+   bool operator>=(const InfiniteInt& rhs) const;
+
+   /** compare(const InfiniteInt& rhs)
+    * @brief   Three-way comparison of the integers two InfiniteInts represent, in
+    *          one pass over their limbs. The relational operators all use it.
+    * @param   rhs   The InfiniteInt being compared to.
+    * @return  -1 if this InfiniteInt is less than rhs, 0 if they are equal and 1 if
+    *          it is greater.
+   */
+   int compare(const InfiniteInt& rhs) const;
+
+   /** setKaratsubaThreshold(int)
+    * @brief   Sets the operand size from which operator* switches from
+    *          schoolbook multiplication to Karatsuba.
+    * @param   limbs    The new threshold, in limbs
+    * @pre     No other thread is multiplying InfiniteInts.
+    * @post    Products whose smaller operand has at least limbs limbs are split
+    *          with Karatsuba; smaller products use schoolbook multiplication.
+    * @throw   std::invalid_argument if limbs is less than 4 (smaller operands
+    *          cannot be split into strictly smaller products).
+   */
+   static void setKaratsubaThreshold(int limbs);
+
+   /** karatsubaThreshold()
+    * @brief   Returns the operand size from which operator* uses Karatsuba.
+    * @return  The current threshold, in limbs.
+   */
+   static int karatsubaThreshold();
+
+   /** setToom3Threshold(int)
+    * @brief   Sets the operand size from which operator* multiplies operands of
+    *          similar size with Toom-3 instead of Karatsuba.
+    * @param   limbs    The new threshold, in limbs
+    * @pre     No other thread is multiplying InfiniteInts.
+    * @post    Balanced products whose smaller operand has at least limbs limbs
+    *          (and at least karatsubaThreshold() limbs) are split with Toom-3.
+    * @throw   std::invalid_argument if limbs is less than 4.
+   */
+   static void setToom3Threshold(int limbs);
+
+   /** toom3Threshold()
+    * @brief   Returns the operand size from which operator* uses Toom-3.
+    * @return  The current threshold, in limbs.
+   */
+   static int toom3Threshold();
+
+   /** setUnbalancedToomThreshold(int)
+    * @brief   Sets the operand size from which operator* multiplies operands of
+    *          different sizes with Toom-2.5 or Toom-4.2.
+    * @param   limbs    The new threshold, in limbs
+    * @pre     No other thread is multiplying InfiniteInts.
+    * @post    Products whose longer operand is 1.25 to 2.5 times the length of
+    *          the shorter one, and whose shorter operand has at least limbs limbs
+    *          (and at least karatsubaThreshold() limbs), use Toom-2.5 (below 1.75
+    *          times) or Toom-4.2.
+    * @throw   std::invalid_argument if limbs is less than 4.
+   */
+   static void setUnbalancedToomThreshold(int limbs);
+
+   /** unbalancedToomThreshold()
+    * @brief   Returns the operand size from which operator* uses Toom-2.5 and Toom-4.2.
+    * @return  The current threshold, in limbs.
+   */
+   static int unbalancedToomThreshold();
+
+   /** setNttThreshold(int)
+    * @brief   Sets the operand size from which operator* multiplies with number
+    *          theoretic transforms.
+    * @param   limbs    The new threshold, in limbs
+    * @pre     No other thread is multiplying InfiniteInts.
+    * @post    Products whose smaller operand has at least limbs limbs (and at least
+    *          karatsubaThreshold() limbs) use NTT multiplication, as long as the
+    *          product has at most kMaxNttLength limbs.
+    * @throw   std::invalid_argument if limbs is less than 1.
+   */
+   static void setNttThreshold(int limbs);
+
+   /** nttThreshold()
+    * @brief   Returns the operand size from which operator* uses NTT multiplication.
+    * @return  The current threshold, in limbs.
+   */
+   static int nttThreshold();
+
+   /** setBurnikelZieglerThreshold(int)
+    * @brief   Sets the divisor size from which division switches from long
+    *          division to recursive Burnikel-Ziegler division.
+    * @param   limbs    The new threshold, in limbs
+    * @pre     No other thread is dividing InfiniteInts.
+    * @post    Divisions whose divisor and quotient both have at least limbs limbs
+    *          use Burnikel-Ziegler (or Newton) division, which also long divides
+    *          the pieces that its recursion splits below limbs.
+    * @throw   std::invalid_argument if limbs is less than 2.
+   */
+   static void setBurnikelZieglerThreshold(int limbs);
+
+   /** burnikelZieglerThreshold()
+    * @brief   Returns the divisor size from which division uses Burnikel-Ziegler.
+    * @return  The current threshold, in limbs.
+   */
+   static int burnikelZieglerThreshold();
+
+   /** setNewtonDivisionThreshold(int)
+    * @brief   Sets the divisor size from which division multiplies by a reciprocal
+    *          found with Newton's method.
+    * @param   limbs    The new threshold, in limbs
+    * @pre     No other thread is dividing InfiniteInts.
+    * @post    Divisions whose divisor has at least limbs limbs (and which would
+    *          otherwise use Burnikel-Ziegler) use Newton division.
+    * @throw   std::invalid_argument if limbs is less than 2.
+   */
+   static void setNewtonDivisionThreshold(int limbs);
+
+   /** newtonDivisionThreshold()
+    * @brief   Returns the divisor size from which division uses Newton's method.
+    * @return  The current threshold, in limbs.
+   */
+   static int newtonDivisionThreshold();
+
+   /** setHalfGcdThreshold(int)
+    * @brief   Sets the operand size from which gcd() and extendedGcd() shorten
+    *          their operands with half-GCD before running Lehmer's algorithm.
+    * @param   limbs    The new threshold, in limbs
+    * @pre     No other thread is taking gcds of InfiniteInts.
+    * @post    Gcds of numbers with at least limbs limbs (and the half-GCD steps
+    *          within them) are split recursively; shorter ones use Lehmer steps.
+    * @throw   std::invalid_argument if limbs is less than 4.
+   */
+   static void setHalfGcdThreshold(int limbs);
+
+   /** halfGcdThreshold()
+    * @brief   Returns the operand size from which gcds use half-GCD.
+    * @return  The current threshold, in limbs.
+   */
+   static int halfGcdThreshold();
+
 private:
+   // TYPES
+   typedef std::uint32_t Limb;             // a limb, as used by the flat-array kernels
+   typedef std::vector<Limb> LimbVector;   // a flat array of limbs, ordered from lowest to highest
+   struct SignedLimbs;                     // a signed flat limb array, for Toom intermediates
+   struct GcdMatrix;                       // a 2x2 matrix of limb arrays, for half-GCD
+
+   // CONSTANTS
+#ifdef INFINITEINT_BINARY
+   static const unsigned long long kLimbBase = 4294967296ULL;  // 2^32; every limb is in [0, kLimbBase)
+#else
+   static const unsigned long long kLimbBase = 1000000000ULL;  // 10^9; every limb is in [0, kLimbBase)
+#endif
+   /* Rows of limb products a normalized 64-bit column (< kLimbBase) can absorb, plus
+      the carry from the column below, before it could overflow: 18 for decimal limbs,
+      but only 1 (no headroom) for binary limbs. */
+   static const int kDeferredRows = static_cast<int>((ULLONG_MAX - (kLimbBase - 1) - ULLONG_MAX / kLimbBase) /
+                                                     ((kLimbBase - 1) * (kLimbBase - 1)));
+   static const int kChunkDigits = 9;           // # of decimal digits converted at a time by stream I/O
+   static const int kChunkBase = 1000000000;    // 10^kChunkDigits
+   static const int kChunkConversionLimbs = 128; // binary stream I/O converts runs of this many chunks or fewer directly
+   static const int kMaxNttLength = 1 << 26;    // longest product, in limbs, that NTT multiplication supports
+
    // DATA MEMBERS
-   DEIntQueue digits_;   // stores the digits in this InfiniteInt (ordered from highest digit to lowest)
+   DEIntQueue digits_;   // stores the limbs of this InfiniteInt (ordered from highest limb to lowest); empty while isSmall_
    bool isNegative_;     // indicates if the number represented is negative (true) or positive (false)
+   bool isSmall_;        // true if the number is held inline in small_, which is exactly when it is in [-LLONG_MAX, LLONG_MAX]
+   long long small_;     // the number represented while isSmall_ (never LLONG_MIN, so it can always be negated)
+
+   // CLASS MEMBERS
+   static int karatsubaThreshold_;        // operands below this many limbs are multiplied with the schoolbook kernel
+   static int toom3Threshold_;            // balanced operands from this many limbs are multiplied with Toom-3
+   static int unbalancedToomThreshold_;   // unbalanced operands from this many limbs use Toom-2.5/Toom-4.2
+   static int nttThreshold_;              // operands from this many limbs are multiplied with NTTs
+   static int burnikelZieglerThreshold_;  // divisors (and quotients) below this many limbs use long division
+   static int newtonDivisionThreshold_;   // divisors from this many limbs are divided with a Newton reciprocal
+   static int halfGcdThreshold_;          // gcd operands from this many limbs are shortened with half-GCD
 
    // PRIVATE METHODS
+   /** assignProduct(const InfiniteInt&, const InfiniteInt&)
+    * @brief   Sets this InfiniteInt to the product of two others.
+    * @param   lhs   First factor (may be this InfiniteInt)
+    * @param   rhs   Second factor (may be this InfiniteInt)
+    * @post    This InfiniteInt represents the product of lhs's number and rhs's.
+   */
+   void assignProduct(const InfiniteInt& lhs, const InfiniteInt& rhs);
+
+   /** assignSquare(const InfiniteInt&)
+    * @brief   Sets this InfiniteInt to the square of another.
+    * @param   source   The InfiniteInt to square (may be this InfiniteInt)
+    * @post    This InfiniteInt represents the square of source's number.
+   */
+   void assignSquare(const InfiniteInt& source);
+
+   /** multiplyByWord(const InfiniteInt&, long long)
+    * @brief   Sets this InfiniteInt to the product of another and a machine integer.
+    * @param   lhs      The InfiniteInt factor (may be this InfiniteInt)
+    * @param   factor   The integer factor
+    * @post    This InfiniteInt represents the product of lhs's number and factor.
+   */
+   void multiplyByWord(const InfiniteInt& lhs, long long factor);
+
+   /** divideByWord(const InfiniteInt&, long long)
+    * @brief   Sets this InfiniteInt to the quotient of another and a machine integer.
+    * @param   lhs      The dividend (may be this InfiniteInt)
+    * @param   divisor  The integer divisor
+    * @post    This InfiniteInt represents lhs's number divided by divisor,
+    *          truncated toward zero.
+    * @return  The remainder, which has the sign of lhs's number.
+    * @throw   std::domain_error if divisor is 0.
+   */
+   long long divideByWord(const InfiniteInt& lhs, long long divisor);
+
+   /** remainderByWord(long long)
+    * @brief   Finds the remainder of dividing this InfiniteInt by a machine integer.
+    * @param   divisor  The integer divisor
+    * @return  The remainder, which has the sign of this InfiniteInt's number.
+    * @throw   std::domain_error if divisor is 0.
+   */
+   long long remainderByWord(long long divisor) const;
+
+   /** wordMagnitude(long long)
+    * @brief   Returns the magnitude of a long long, which is exact even for LLONG_MIN.
+    * @param   value    The number whose magnitude is returned
+    * @return  The magnitude of value.
+   */
+   static unsigned long long wordMagnitude(long long value);
+
+   /** assignWord(unsigned __int128, bool)
+    * @brief   Sets this InfiniteInt to a signed machine integer of up to 128 bits,
+    *          inline if it fits and otherwise straight into limbs.
+    * @param   magnitude   The magnitude of the number
+    * @param   negative    True if the number is negative
+    * @post    This InfiniteInt is normalized and represents the number.
+   */
+   void assignWord(unsigned __int128 magnitude, bool negative);
+
+   /** limbMagnitude(unsigned long long&)
+    * @brief   Reads the magnitude of a number held in limbs into a machine word.
+    * @param   magnitude   Set to the magnitude, if it fits
+    * @pre     This InfiniteInt is held in limbs.
+    * @return  True if the magnitude is at most ULLONG_MAX and false otherwise.
+   */
+   bool limbMagnitude(unsigned long long& magnitude) const;
+
+   /** smallLimbs(Limb*)
+    * @brief   Splits the magnitude of an inline number into limbs.
+    * @param   limbs    Array to write the limbs to, lowest first
+    * @pre     This InfiniteInt is inline and limbs has room for 3 limbs.
+    * @return  The number of limbs written (at least 1).
+   */
+   int smallLimbs(Limb* limbs) const;
+
+   /** addMagnitudeInPlace(const InfiniteInt&)
+    * @brief   Adds the magnitude of another InfiniteInt to this one's, in place.
+    * @param   rhs   The InfiniteInt whose magnitude is added (may be this InfiniteInt)
+    * @pre     This InfiniteInt is held in limbs.
+    * @post    This InfiniteInt's magnitude is the sum of its old magnitude and rhs's;
+    *          its sign is unchanged.
+   */
+   void addMagnitudeInPlace(const InfiniteInt& rhs);
+
+   /** subtractMagnitudeInPlace(const InfiniteInt&)
+    * @brief   Subtracts the magnitude of another InfiniteInt from this one's, in place.
+    * @param   rhs   The InfiniteInt whose magnitude is subtracted (may be this InfiniteInt)
+    * @pre     This InfiniteInt is held in limbs.
+    * @post    This InfiniteInt's magnitude is the absolute difference of its old
+    *          magnitude and rhs's. Its sign has been flipped if rhs's magnitude
+    *          was the larger, and leading zero limbs have been removed.
+   */
+   void subtractMagnitudeInPlace(const InfiniteInt& rhs);
+
    /** add(const InfiniteInt&, const InfiniteInt&)
     * @brief   Helper method to add InfiniteInts. Ignores the sign of both
     * InfiniteInts.
@@ -137,9 +817,532 @@ private:
    */
    InfiniteInt subtract(const InfiniteInt& lhs, const InfiniteInt& rhs) const;
 
+   /** compareMagnitude(const InfiniteInt&)
+    * @brief   Compares the absolute values of this InfiniteInt and another
+    *          without copying either.
+    * @param   rhs   The InfiniteInt being compared to
+    * @pre     Both InfiniteInts are normalized, or both are held in limbs.
+    * @return  A negative value if |this| < |rhs|, 0 if they are equal, and a
+    *          positive value if |this| > |rhs|.
+   */
+   int compareMagnitude(const InfiniteInt& rhs) const;
+
+   /** setSmall(long long)
+    * @brief   Stores a number inline, releasing any limbs.
+    * @param   value    The number to store
+    * @pre     value is not LLONG_MIN.
+    * @post    This InfiniteInt represents value in its inline form.
+   */
+   void setSmall(long long value);
+
+   /** clearLimbs(int)
+    * @brief   Switches this InfiniteInt to empty limb storage, for a kernel to fill.
+    * @param   capacity The number of limbs to reserve room for
+    * @post    This InfiniteInt has no limbs, is not negative and is not inline.
+   */
+   void clearLimbs(int capacity);
+
+   /** spill()
+    * @brief   Moves an inline number into limb storage.
+    * @post    This InfiniteInt represents the same number, held in digits_.
+   */
+   void spill();
+
+   /** spilled(InfiniteInt&)
+    * @brief   Gives this InfiniteInt's number in limb storage, copying only if
+    *          it is currently inline.
+    * @param   scratch  InfiniteInt that receives the limbs when a copy is needed
+    * @return  Reference to *this if its number is already in limbs, otherwise
+    *          to scratch.
+   */
+   const InfiniteInt& spilled(InfiniteInt& scratch) const;
+
+   /** normalize()
+    * @brief   Moves a number held in limbs back inline if it fits.
+    * @pre     digits_ has no leading zero limbs.
+    * @post    isSmall_ is true exactly when the number is in [-LLONG_MAX, LLONG_MAX].
+   */
+   void normalize();
+
+   /** magnitudeLimbs()
+    * @brief   Copies the magnitude of this InfiniteInt into a flat limb array.
+    * @return  The limbs of this InfiniteInt's magnitude, ordered from lowest to highest.
+   */
+   LimbVector magnitudeLimbs() const;
+
+   /** assignMagnitude(const LimbVector&, bool)
+    * @brief   Sets this InfiniteInt from a flat limb array and a sign.
+    * @param   limbs       The magnitude, ordered from lowest limb to highest (may
+    *                      have leading zero limbs)
+    * @param   negative    Whether the number is negative (ignored for zero)
+    * @post    This InfiniteInt represents the given number, inline if it fits.
+   */
+   void assignMagnitude(const LimbVector& limbs, bool negative);
+
+   /** addLimbs(const Limb*, int, const Limb*, int, Limb*)
+    * @brief   Adds two limb arrays.
+    * @param   lhs      First addend, ordered from lowest limb to highest
+    * @param   lhsSize  # of limbs in lhs
+    * @param   rhs      Second addend, ordered from lowest limb to highest
+    * @param   rhsSize  # of limbs in rhs
+    * @param   sum      Array to write the lowest lhsSize limbs of the sum to
+    * @pre     lhsSize >= rhsSize and sum has room for lhsSize limbs.
+    * @return  The carry out of the highest limb (0 or 1).
+   */
+   static Limb addLimbs(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* sum);
+
+   /** addLimbsInPlace(Limb*, int, const Limb*, int)
+    * @brief   Adds one limb array into another, carrying as far as needed.
+    * @param   lhs      The array being added to, ordered from lowest limb to highest
+    * @param   lhsSize  # of limbs in lhs
+    * @param   rhs      The array being added, ordered from lowest limb to highest
+    * @param   rhsSize  # of limbs in rhs
+    * @pre     lhsSize >= rhsSize and the sum fits in lhsSize limbs.
+    * @post    lhs holds the sum.
+   */
+   static void addLimbsInPlace(Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize);
+
+   /** subtractLimbsInPlace(Limb*, int, const Limb*, int)
+    * @brief   Subtracts one limb array from another, borrowing as far as needed.
+    * @param   lhs      The array being subtracted from, ordered from lowest limb to highest
+    * @param   lhsSize  # of limbs in lhs
+    * @param   rhs      The array being subtracted, ordered from lowest limb to highest
+    * @param   rhsSize  # of limbs in rhs
+    * @pre     lhsSize >= rhsSize and lhs's number is at least rhs's.
+    * @post    lhs holds the difference.
+   */
+   static void subtractLimbsInPlace(Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize);
+
+   /** multiplyLimbs(const Limb*, int, const Limb*, int, Limb*)
+    * @brief   Multiplies two limb arrays, choosing the algorithm by operand size.
+    * @param   lhs      First factor, ordered from lowest limb to highest
+    * @param   lhsSize  # of limbs in lhs (at least 1)
+    * @param   rhs      Second factor, ordered from lowest limb to highest
+    * @param   rhsSize  # of limbs in rhs (at least 1)
+    * @param   product  Array to write the product to
+    * @pre     product has room for lhsSize + rhsSize limbs and does not overlap
+    *          lhs or rhs.
+    * @post    All lhsSize + rhsSize limbs of product have been written.
+   */
+   static void multiplyLimbs(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product);
+
+   /** squareLimbs(const Limb*, int, Limb*)
+    * @brief   Squares a limb array, choosing the algorithm by operand size.
+    * @param   limbs    The number to square, ordered from lowest limb to highest
+    * @param   size     # of limbs in limbs (at least 1)
+    * @param   product  Array to write the square to
+    * @pre     product has room for 2 * size limbs and does not overlap limbs.
+    * @post    All 2 * size limbs of product have been written.
+   */
+   static void squareLimbs(const Limb* limbs, int size, Limb* product);
+
+   /** schoolbookSquare(const Limb*, int, Limb*)
+    * @brief   Squares a limb array by forming each product of two different limbs
+    *          once, doubling them and adding the squares of the limbs.
+    * @pre     As for squareLimbs.
+    * @post    All 2 * size limbs of product have been written.
+   */
+   static void schoolbookSquare(const Limb* limbs, int size, Limb* product);
+
+   /** karatsubaSquare(const Limb*, int, Limb*)
+    * @brief   Squares a limb array by splitting it in half and using three
+    *          half-sized squares.
+    * @pre     As for squareLimbs, and size >= 4.
+    * @post    All 2 * size limbs of product have been written.
+   */
+   static void karatsubaSquare(const Limb* limbs, int size, Limb* product);
+
+   /** schoolbookMultiply(const Limb*, int, const Limb*, int, Limb*)
+    * @brief   Multiplies two limb arrays one row at a time, accumulating every row
+    *          into a single buffer of 64-bit columns with deferred carries.
+    * @pre     As for multiplyLimbs.
+    * @post    All lhsSize + rhsSize limbs of product have been written.
+   */
+   static void schoolbookMultiply(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product);
+
+   /** karatsubaMultiply(const Limb*, int, const Limb*, int, Limb*)
+    * @brief   Multiplies two limb arrays by splitting each in half and using three
+    *          half-sized products instead of four.
+    * @pre     As for multiplyLimbs, and lhsSize >= rhsSize >= 4.
+    * @post    All lhsSize + rhsSize limbs of product have been written.
+   */
+   static void karatsubaMultiply(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product);
+
+   /** multiplyInPieces(const Limb*, int, const Limb*, int, Limb*)
+    * @brief   Multiplies a long limb array by a much shorter one, one piece of the
+    *          long array (as long as the short one) at a time.
+    * @pre     As for multiplyLimbs, and lhsSize >= rhsSize.
+    * @post    All lhsSize + rhsSize limbs of product have been written.
+   */
+   static void multiplyInPieces(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product);
+
+   /** toomMultiply(const Limb*, int, int, const Limb*, int, int, Limb*)
+    * @brief   Multiplies two limb arrays by splitting them into pieces, evaluating
+    *          the pieces as polynomials at a few small points and interpolating.
+    * @pre     As for multiplyLimbs, lhsSize >= rhsSize >= 4 and lhsPieces + rhsPieces
+    *          is 5 (Toom-2.5) or 6 (Toom-3, Toom-4.2).
+    * @post    All lhsSize + rhsSize limbs of product have been written.
+   */
+   static void toomMultiply(const Limb* lhs, int lhsSize, int lhsPieces,
+                            const Limb* rhs, int rhsSize, int rhsPieces, Limb* product);
+
+   /** nttMultiply(const Limb*, int, const Limb*, int, Limb*)
+    * @brief   Multiplies two limb arrays exactly by convolving their limbs with
+    *          number theoretic transforms modulo three primes and recombining the
+    *          residues with the Chinese remainder theorem.
+    * @pre     As for multiplyLimbs, and lhsSize + rhsSize <= kMaxNttLength.
+    * @post    All lhsSize + rhsSize limbs of product have been written.
+   */
+   static void nttMultiply(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize, Limb* product);
+
+   /** numberTheoreticTransform(std::vector<std::uint32_t>&, bool, std::uint32_t, std::uint32_t)
+    * @brief   Transforms values in place with an iterative radix-2 NTT.
+    * @pre     values.size() is a power of two dividing prime - 1, prime is below
+    *          2^31 and every value is less than prime.
+    * @post    values holds the (inverse) transform of its old contents modulo prime.
+   */
+   static void numberTheoreticTransform(std::vector<std::uint32_t>& values, bool inverse,
+                                        std::uint32_t prime, std::uint32_t primitiveRoot);
+
+   /** powModPrime(std::uint32_t, unsigned long long, std::uint32_t)
+    * @brief   Raises a number to a power modulo a prime below 2^31.
+    * @return  base^exponent mod prime.
+   */
+   static std::uint32_t powModPrime(std::uint32_t base, unsigned long long exponent, std::uint32_t prime);
+
+   /** compareLimbs(const Limb*, int, const Limb*, int)
+    * @brief   Compares the numbers held in two limb arrays.
+    * @return  A negative value if lhs < rhs, 0 if they are equal, and a positive
+    *          value if lhs > rhs.
+   */
+   static int compareLimbs(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize);
+
+   /** divideLimbs(const Limb*, int, const Limb*, int, Limb*, Limb*)
+    * @brief   Divides one limb array by another, choosing the algorithm by operand size.
+    * @param   numerator        Dividend, ordered from lowest limb to highest
+    * @param   numeratorSize    # of limbs in numerator
+    * @param   denominator      Divisor, ordered from lowest limb to highest
+    * @param   denominatorSize  # of limbs in denominator
+    * @param   quotient         Array to write the quotient to
+    * @param   remainder        Array to write the remainder to
+    * @pre     numeratorSize >= denominatorSize >= 1, the highest limb of denominator
+    *          is not 0, quotient has room for numeratorSize - denominatorSize + 1
+    *          limbs and remainder has room for denominatorSize limbs.
+    * @post    All limbs of quotient and remainder have been written.
+   */
+   static void divideLimbs(const Limb* numerator, int numeratorSize, const Limb* denominator,
+                           int denominatorSize, Limb* quotient, Limb* remainder);
+
+   /** longDivide(const Limb*, int, const Limb*, int, Limb*, Limb*)
+    * @brief   Divides one limb array by another with long division (Knuth's Algorithm D).
+    * @param   numerator        Dividend, ordered from lowest limb to highest
+    * @param   numeratorSize    # of limbs in numerator
+    * @param   denominator      Divisor, ordered from lowest limb to highest
+    * @param   denominatorSize  # of limbs in denominator
+    * @param   quotient         Array to write the quotient to
+    * @param   remainder        Array to write the remainder to
+    * @pre     numeratorSize >= denominatorSize >= 1, the highest limb of denominator
+    *          is not 0, quotient has room for numeratorSize - denominatorSize + 1
+    *          limbs and remainder has room for denominatorSize limbs.
+    * @post    All limbs of quotient and remainder have been written.
+   */
+   static void longDivide(const Limb* numerator, int numeratorSize, const Limb* denominator,
+                          int denominatorSize, Limb* quotient, Limb* remainder);
+
+   /** blockDivide(const Limb*, int, const Limb*, int, Limb*, Limb*, bool)
+    * @brief   Divides one limb array by another a block of limbs at a time, dividing
+    *          each block with Burnikel-Ziegler recursion or a Newton reciprocal.
+    * @param   numerator        Dividend, ordered from lowest limb to highest
+    * @param   numeratorSize    # of limbs in numerator
+    * @param   denominator      Divisor, ordered from lowest limb to highest
+    * @param   denominatorSize  # of limbs in denominator
+    * @param   quotient         Array to write the quotient to
+    * @param   remainder        Array to write the remainder to
+    * @param   newton           Divide each block by multiplying with a reciprocal
+    *                           rather than with Burnikel-Ziegler recursion
+    * @pre     numeratorSize >= denominatorSize >= 2, the highest limb of denominator
+    *          is not 0, quotient has room for numeratorSize - denominatorSize + 1
+    *          limbs and remainder has room for denominatorSize limbs.
+    * @post    All limbs of quotient and remainder have been written.
+   */
+   static void blockDivide(const Limb* numerator, int numeratorSize, const Limb* denominator,
+                           int denominatorSize, Limb* quotient, Limb* remainder, bool newton);
+
+   /** divideTwoByOne(const Limb*, const Limb*, int, Limb*, Limb*)
+    * @brief   Divides a 2n-limb number by an n-limb one with Burnikel-Ziegler recursion.
+    * @param   a           Dividend of 2 * n limbs, ordered from lowest limb to highest
+    * @param   b           Divisor of n limbs, ordered from lowest limb to highest
+    * @param   n           # of limbs in b
+    * @param   quotient    Array to write the n-limb quotient to
+    * @param   remainder   Array to write the n-limb remainder to
+    * @pre     The highest limb of b is at least kLimbBase / 2, and the highest n limbs
+    *          of a hold a number less than b.
+    * @post    All limbs of quotient and remainder have been written.
+   */
+   static void divideTwoByOne(const Limb* a, const Limb* b, int n, Limb* quotient, Limb* remainder);
+
+   /** divideThreeByTwo(const Limb*, const Limb*, int, Limb*, Limb*)
+    * @brief   Divides a 3n-limb number by a 2n-limb one with Burnikel-Ziegler recursion.
+    * @param   a           Dividend of 3 * n limbs, ordered from lowest limb to highest
+    * @param   b           Divisor of 2 * n limbs, ordered from lowest limb to highest
+    * @param   n           Half the # of limbs in b
+    * @param   quotient    Array to write the n-limb quotient to
+    * @param   remainder   Array to write the 2n-limb remainder to
+    * @pre     The highest limb of b is at least kLimbBase / 2, and the highest 2 * n
+    *          limbs of a hold a number less than b.
+    * @post    All limbs of quotient and remainder have been written.
+   */
+   static void divideThreeByTwo(const Limb* a, const Limb* b, int n, Limb* quotient, Limb* remainder);
+
+   /** reciprocalLimbs(const Limb*, int)
+    * @brief   Finds the reciprocal of a limb array with Newton's method.
+    * @param   b     The number to invert, ordered from lowest limb to highest
+    * @param   n     # of limbs in b
+    * @pre     The highest limb of b is at least kLimbBase / 2.
+    * @return  floor((kLimbBase^(2n) - 1) / b), in n + 1 limbs.
+   */
+   static LimbVector reciprocalLimbs(const Limb* b, int n);
+
+   /** divideByReciprocal(const Limb*, const Limb*, const LimbVector&, int, Limb*, Limb*)
+    * @brief   Divides a 2n-limb number by an n-limb one by multiplying with its reciprocal.
+    * @param   a           Dividend of 2 * n limbs, ordered from lowest limb to highest
+    * @param   b           Divisor of n limbs, ordered from lowest limb to highest
+    * @param   reciprocal  b's reciprocal, as returned by reciprocalLimbs
+    * @param   n           # of limbs in b
+    * @param   quotient    Array to write the n-limb quotient to
+    * @param   remainder   Array to write the n-limb remainder to
+    * @pre     The highest limb of b is at least kLimbBase / 2, and the highest n limbs
+    *          of a hold a number less than b.
+    * @post    All limbs of quotient and remainder have been written.
+   */
+   static void divideByReciprocal(const Limb* a, const Limb* b, const LimbVector& reciprocal, int n,
+                                  Limb* quotient, Limb* remainder);
+
+   /** multiplyLimbsBySmall(const Limb*, int, Limb, Limb*)
+    * @brief   Multiplies a limb array by a single limb.
+    * @param   limbs    The number to multiply, ordered from lowest limb to highest
+    * @param   size     # of limbs in limbs
+    * @param   factor   The limb to multiply by
+    * @param   product  Array to write the lowest size limbs of the product to (may be limbs)
+    * @return  The limb carried out of the top of the product.
+   */
+   static Limb multiplyLimbsBySmall(const Limb* limbs, int size, Limb factor, Limb* product);
+
+   /** divideLimbsBySmall(const Limb*, int, Limb, Limb*)
+    * @brief   Divides a limb array by a single limb.
+    * @param   numerator        Dividend, ordered from lowest limb to highest
+    * @param   numeratorSize    # of limbs in numerator
+    * @param   denominator      Divisor (not 0)
+    * @param   quotient         Array to write the quotient to (may be numerator)
+    * @pre     quotient has room for numeratorSize limbs.
+    * @return  The remainder.
+   */
+   static Limb divideLimbsBySmall(const Limb* numerator, int numeratorSize, Limb denominator, Limb* quotient);
+
+   /** binaryGcd(unsigned long long, unsigned long long)
+    * @brief   Finds the gcd of two machine words with Stein's binary algorithm.
+    * @param   lhs      First number
+    * @param   rhs      Second number
+    * @return  The gcd (0 only if both numbers are 0).
+   */
+   static unsigned long long binaryGcd(unsigned long long lhs, unsigned long long rhs);
+
+   /** extendedWordGcd(long long, long long, long long&)
+    * @brief   Finds the gcd of two non-negative machine words with the extended
+    *          Euclidean algorithm.
+    * @param   lhs          First number
+    * @param   rhs          Second number
+    * @param   coefficient  Set to a number x, |x| <= max(rhs, 1), with lhs * x
+    *                       congruent to the gcd modulo rhs
+    * @return  The gcd (0 only if both numbers are 0).
+   */
+   static long long extendedWordGcd(long long lhs, long long rhs, long long& coefficient);
+
+   /** gcdLimbs(LimbVector, LimbVector, InfiniteInt*)
+    * @brief   Finds the gcd of two magnitudes with half-GCD and Lehmer steps,
+    *          finishing with binary GCD once both fit in a machine word.
+    * @param   a          First magnitude, lowest limb first
+    * @param   b          Second magnitude, lowest limb first
+    * @param   cofactor   If not null, set to a number x with a * x congruent to the
+    *                     gcd modulo b
+    * @return  The gcd, lowest limb first, with no leading zero limbs.
+   */
+   static LimbVector gcdLimbs(LimbVector a, LimbVector b, InfiniteInt* cofactor);
+
+   /** lehmerMatrix(const LimbVector&, const LimbVector&, int, long long*)
+    * @brief   Runs Euclid's algorithm on the leading 62 bits of two magnitudes,
+    *          keeping only the steps whose quotients are certain to be the full
+    *          numbers' quotients.
+    * @param   a        First magnitude, lowest limb first, with no leading zero limbs
+    * @param   b        Second magnitude, likewise
+    * @param   s        Steps must leave both numbers at least kLimbBase^s (or, if s
+    *                   is 0, above 0)
+    * @param   matrix   Set to {A, B, C, D}: the steps take a and b to A * a + B * b
+    *                   and C * a + D * b. Every entry is below 2^31 in magnitude,
+    *                   the determinant is 1 and each row's entries differ in sign.
+    * @return  true if at least one step was found.
+   */
+   static bool lehmerMatrix(const LimbVector& a, const LimbVector& b, int s, long long* matrix);
+
+   /** applyLehmerMatrix(LimbVector&, LimbVector&, const long long*, LimbVector&)
+    * @brief   Replaces two magnitudes with the combinations a matrix from
+    *          lehmerMatrix() gives.
+    * @param   a        First magnitude; set to A * a + B * b
+    * @param   b        Second magnitude; set to C * a + D * b
+    * @param   matrix   {A, B, C, D}, as set by lehmerMatrix() for a and b
+    * @param   spare    Scratch array (its contents are lost)
+    * @post    a and b have no leading zero limbs.
+   */
+   static void applyLehmerMatrix(LimbVector& a, LimbVector& b, const long long* matrix, LimbVector& spare);
+
+   /** gcdDivideStep(LimbVector&, LimbVector&, int, LimbVector&)
+    * @brief   Replaces the larger of two magnitudes with its remainder modulo the
+    *          smaller, as one Euclidean step. With s above 0 the step follows
+    *          half-GCD's rule: it leaves both numbers at least kLimbBase^s, taking
+    *          one fewer multiple if the remainder would fall below that.
+    * @param   a          First magnitude, with no leading zero limbs
+    * @param   b          Second magnitude, likewise
+    * @param   s          0 for a plain Euclidean step, or the half-GCD bound
+    * @param   quotient   Set to the multiple subtracted, with no leading zero limbs
+    * @return  0 if no step was taken, 1 if a was reduced or 2 if b was.
+   */
+   static int gcdDivideStep(LimbVector& a, LimbVector& b, int s, LimbVector& quotient);
+
+   /** halfGcd(LimbVector&, LimbVector&, GcdMatrix&)
+    * @brief   Runs Euclid's algorithm on two n-limb magnitudes only while both
+    *          stay at least kLimbBase^s, s = n / 2 + 1, recursing on their top
+    *          halves from halfGcdThreshold() limbs (Moller's half-GCD).
+    * @param   a        First magnitude, with no leading zero limbs; reduced in place
+    * @param   b        Second magnitude, likewise
+    * @param   matrix   The identity on entry; set to the matrix taking the reduced
+    *                   numbers back to the originals
+    * @return  true if at least one step was taken.
+   */
+   static bool halfGcd(LimbVector& a, LimbVector& b, GcdMatrix& matrix);
+
+   /** halfGcdStep(LimbVector&, LimbVector&, int, GcdMatrix&, LimbVector&)
+    * @brief   Takes one Lehmer block or Euclidean step of half-GCD.
+    * @param   a        First magnitude, with no leading zero limbs; reduced in place
+    * @param   b        Second magnitude, likewise
+    * @param   s        Both numbers must stay at least kLimbBase^s
+    * @param   matrix   Multiplied on the right by the inverse of the step taken
+    * @param   spare    Scratch array (its contents are lost)
+    * @return  true if a step was taken.
+   */
+   static bool halfGcdStep(LimbVector& a, LimbVector& b, int s, GcdMatrix& matrix, LimbVector& spare);
+
+   /** reduceHighLimbs(LimbVector&, LimbVector&, int, GcdMatrix&)
+    * @brief   Runs halfGcd() on two magnitudes' limbs from p up, and applies the
+    *          matrix found to the whole numbers.
+    * @param   a        First magnitude, with no leading zero limbs; reduced in place
+    * @param   b        Second magnitude, likewise
+    * @param   p        # of low limbs left out of the recursion
+    * @param   matrix   Multiplied on the right by the matrix found
+    * @return  true if the high limbs could be reduced.
+   */
+   static bool reduceHighLimbs(LimbVector& a, LimbVector& b, int p, GcdMatrix& matrix);
+
+   /** limbValue(int)
+    * @brief   Reads a limb stored in digits_.
+    * @param   entry    An entry of digits_
+    * @return  The limb stored in entry, in [0, kLimbBase).
+   */
+   static unsigned long long limbValue(int entry);
+
+   /** limbEntry(unsigned long long)
+    * @brief   Converts a limb into the entry that stores it in digits_.
+    * @param   limb     A limb in [0, kLimbBase)
+    * @return  The entry to store in digits_.
+   */
+   static int limbEntry(unsigned long long limb);
+
+   /** decimalChunks(DEIntQueue&)
+    * @brief   Gives the magnitude of this InfiniteInt in base 10^kChunkDigits,
+    *          converting from binary limbs only if necessary.
+    * @param   scratch  Queue that receives the conversion when one is needed
+    * @post    If the limbs are binary, scratch holds the decimal chunks.
+    * @return  Reference to a queue of the decimal chunks (ordered from highest
+    *          to lowest): digits_ itself for decimal limbs, otherwise scratch.
+   */
+   const DEIntQueue& decimalChunks(DEIntQueue& scratch) const;
+
+   /** bufferedCount(std::streambuf*)
+    * @brief   Counts the characters waiting in a stream buffer's get area.
+    *          Unlike in_avail(), this never counts characters the buffer has
+    *          yet to fetch, so all of them can be put back once taken.
+    * @param   buffer   The stream buffer to check
+    * @return  egptr() - gptr() for buffer, which is 0 for a buffer without a get area.
+   */
+   static std::streamsize bufferedCount(std::streambuf* buffer);
+
+   /** digitRunLength(const char*, int)
+    * @brief   Finds how many characters at the start of some text are digits.
+    * @param   text     The characters to scan
+    * @param   size     # of characters in text
+    * @return  The length of the run of '0' - '9' that text starts with.
+   */
+   static int digitRunLength(const char* text, int size);
+
+   /** eightDigitsValue(const char*)
+    * @brief   Converts eight decimal digits to their value at once.
+    * @param   digits   The digits, highest first
+    * @pre     All eight characters are '0' - '9'.
+    * @return  The value of the digits, in [0, 10^8).
+   */
+   static Limb eightDigitsValue(const char* digits);
+
+   /** assignDecimalChunks(const LimbVector&, bool)
+    * @brief   Sets this InfiniteInt from its magnitude in base kChunkBase and a sign.
+    * @param   chunks      The magnitude in base kChunkBase, ordered from lowest
+    *                      chunk to highest (may have leading zero chunks)
+    * @param   negative    Whether the number is negative (ignored for zero)
+    * @post    This InfiniteInt represents the given number, inline if it fits.
+   */
+   void assignDecimalChunks(const LimbVector& chunks, bool negative);
+
+#ifdef INFINITEINT_BINARY
+   /** chunkPowers(int)
+    * @brief   Builds the powers of kChunkBase that split a number of some # of
+    *          chunks in halves, each the square of the one before.
+    * @param   size     # of chunks in the numbers to split
+    * @return  kChunkBase^(2^j) in binary limbs (ordered from lowest to highest,
+    *          without leading zero limbs) for every 2^j below size, and at least j = 0.
+   */
+   static std::vector<LimbVector> chunkPowers(int size);
+
+   /** chunksToLimbs(const Limb*, int, const std::vector<LimbVector>&, Limb*)
+    * @brief   Converts a magnitude from base kChunkBase to binary limbs, splitting
+    *          it in halves so that the large products use the fast multiplications.
+    * @param   chunks   The magnitude in base kChunkBase, ordered from lowest chunk to highest
+    * @param   size     # of chunks (at least 1)
+    * @param   powers   kChunkBase^(2^j) in binary limbs for every 2^j below size
+    * @param   limbs    Array to write the size-limb result to
+    * @pre     limbs has room for size limbs and does not overlap chunks.
+    * @post    All size limbs of limbs have been written.
+   */
+   static void chunksToLimbs(const Limb* chunks, int size, const std::vector<LimbVector>& powers, Limb* limbs);
+
+   /** limbsToChunks(const Limb*, int, const std::vector<LimbVector>&, int, Limb*)
+    * @brief   Converts a magnitude from binary limbs to base kChunkBase, splitting
+    *          it in halves so that the large quotients use the fast divisions.
+    * @param   limbs    The magnitude in binary limbs, ordered from lowest limb to highest
+    *                   (may have leading zero limbs)
+    * @param   size     # of limbs in limbs
+    * @param   powers   kChunkBase^(2^j) in binary limbs for every 2^j below numChunks
+    * @param   numChunks   # of chunks to write
+    * @param   chunks   Array to write the chunks to, ordered from lowest chunk to highest
+    * @pre     The magnitude is below kChunkBase^numChunks, numChunks >= 1 and chunks
+    *          has room for numChunks chunks.
+    * @post    All numChunks chunks of chunks have been written, the highest ones
+    *          possibly 0.
+   */
+   static void limbsToChunks(const Limb* limbs, int size, const std::vector<LimbVector>& powers,
+                             int numChunks, Limb* chunks);
+#endif
+
    /** removeLeadingZeroes()
-    * @brief   Removes any leading zero digits from this InfiniteInt.
-    * @post    All leading zero digits, other than the ones digit, have been
+    * @brief   Removes any leading zero limbs from this InfiniteInt.
+    * @post    All leading zero limbs, other than the lowest limb, have been
     *          removed from this InfiniteInt.
    */
    void removeLeadingZeroes();
@@ -147,8 +1350,41 @@ private:
    // Allow access to private members by stream I/O
    friend std::ostream& operator<<(std::ostream& outStream, const InfiniteInt& IIToPrint);
    friend std::istream& operator>>(std::istream& inStream, InfiniteInt& IIToFill);
+
+   // Allow modular arithmetic to run on the flat-array kernels
+   friend class ModularContext;
+   friend class Reducer;
 };
 
+/** tryConvert(T&)
+ * @brief   Converts an InfiniteInt to any built-in integer type of up to 64 bits
+ *          if it fits, without throwing or allocating.
+ * @param   value    Set to the number represented by the InfiniteInt, if it fits
+ * @post    If the number is within T's range, value equals it. Otherwise value
+ *          is unchanged.
+ * @return  True if the number fit in a T and false otherwise.
+*/
+template <typename T>
+bool InfiniteInt::tryConvert(T& value) const {
+   static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(long long),
+                 "tryConvert needs a built-in integer type of at most 64 bits.");
+   if (std::is_signed<T>::value) {
+      long long wide{0};
+      if (!toInt64(wide) || wide < static_cast<long long>(std::numeric_limits<T>::min()) ||
+          wide > static_cast<long long>(std::numeric_limits<T>::max())) {
+         return false;
+      }
+      value = static_cast<T>(wide);
+   } else {
+      unsigned long long wide{0};
+      if (!toUint64(wide) || wide > static_cast<unsigned long long>(std::numeric_limits<T>::max())) {
+         return false;
+      }
+      value = static_cast<T>(wide);
+   }
+   return true;
+}
+
 /** operator<<(ostream&, const InfiniteInt&)
  * @brief   Outputs a InfiniteInt to an output stream
  * @param   outStream      The stream to print the queue's entries to
@@ -172,7 +1408,19 @@ std::ostream& operator<<(std::ostream& outStream, const InfiniteInt& IIToPrint);
  *          order in which they were read. If the first character was '-' followed
  *          by at least one digit, then the InfiniteInt has been set to be negative
  *          and all consecutive digits have been read and stored, as before. In
- *          all other cases, the InfiniteInt is set to zero.
+ *          all other cases, the InfiniteInt is set to zero. Reaching the end
+ *          of the stream sets eofbit, and failbit as well if it was reached
+ *          before any character other than whitespace.
  * @return  Reference to the modified stream.
 */
-std::istream& operator>>(std::istream& inStream, InfiniteInt& IIToFill);
\ No newline at end of file
+std::istream& operator>>(std::istream& inStream, InfiniteInt& IIToFill);
+
+/** swap(InfiniteInt&, InfiniteInt&)
+ * @brief   Exchanges the integers represented by two InfiniteInts in O(1).
+ * @param   lhs   The first InfiniteInt
+ * @param   rhs   The second InfiniteInt
+ * @post    lhs represents rhs's former integer and vice versa.
+*/
+void swap(InfiniteInt& lhs, InfiniteInt& rhs) noexcept;
+
+#endif
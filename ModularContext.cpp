@@ -0,0 +1,337 @@
+/**
+ * @file ModularContext.cpp
+ * @brief Implementation for ModularContext, which holds the constants for
+ *    arithmetic modulo one fixed InfiniteInt so that many modular
+ *    exponentiations can share them
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+#include "ModularContext.h"
+#include <algorithm>  // std::copy, std::fill and std::max
+#include <stdexcept>  // std::domain_error and std::invalid_argument
+
+// Modulus size, in limbs, from which Barrett reduction beats Montgomery form
+int ModularContext::montgomeryThreshold_ = 700;
+
+/** ModularContext(const InfiniteInt&)
+ * @brief   Constructor. Precomputes the constants for reducing by modulus.
+ * @param   modulus  The number that results are reduced by
+ * @pre     modulus is positive.
+ * @post    This context works modulo modulus.
+ * @throw   std::domain_error if modulus is not positive.
+*/
+ModularContext::ModularContext(const InfiniteInt& modulus)
+   : reducer_(modulus), size_(0), montgomery_(false), inverse_(0) {
+   if (modulus <= InfiniteInt(0)) {
+      throw std::domain_error("ModularContext modulus must be positive.");
+   }
+   limbs_ = modulus.magnitudeLimbs();
+   size_ = static_cast<int>(limbs_.size());
+
+   // Invert the lowest limb modulo the limb base with the extended Euclidean
+   // algorithm; it (and so the modulus) is invertible exactly when the gcd is 1
+   long long a = limbs_[0];
+   long long b = static_cast<long long>(kLimbBase);
+   long long x{1};
+   long long y{0};
+   while (b != 0) {
+      const long long q = a / b;
+      long long t = a - q * b;
+      a = b;
+      b = t;
+      t = x - q * y;
+      x = y;
+      y = t;
+   }
+   montgomery_ = a == 1 && size_ < montgomeryThreshold_;
+
+   // Montgomery form needs R^2 mod m, for converting residues into it
+   if (montgomery_) {
+      if (x < 0) {
+         x += static_cast<long long>(kLimbBase);
+      }
+      inverse_ = static_cast<Limb>((kLimbBase - static_cast<unsigned long long>(x)) % kLimbBase);
+      LimbVector power(2 * size_ + 1, 0);
+      power[2 * size_] = 1;
+      InfiniteInt rSquared;
+      rSquared.assignMagnitude(power, false);
+      rSquared_ = reducer_.reduce(rSquared).magnitudeLimbs();
+      rSquared_.resize(size_, 0);
+   }
+}
+
+/** pow(const InfiniteInt&, const InfiniteInt&)
+ * @brief   Raises a number to a power modulo this context's modulus, using
+ *          sliding-window exponentiation.
+ * @param   base        The number to raise (may be negative or not reduced)
+ * @param   exponent    The power to raise base to
+ * @pre     exponent is not negative.
+ * @post    This context is unchanged, so one context may be shared by threads,
+ *          and the result may be destroyed on any thread.
+ * @return  InfiniteInt representing base^exponent mod modulus(), in [0, modulus()).
+ * @throw   std::domain_error if exponent is negative.
+*/
+InfiniteInt ModularContext::pow(const InfiniteInt& base, const InfiniteInt& exponent) const {
+   if (exponent.isNegative_) {
+      throw std::domain_error("ModularContext exponent must not be negative.");
+   }
+   InfiniteInt result;        // base^exponent mod the modulus
+   std::vector<unsigned char> bits = exponentBits(exponent);
+   if (size_ == 1 && limbs_[0] == 1) {
+      return result;
+   }
+   if (bits.empty()) {
+      result.setSmall(1);
+      return result;
+   }
+
+   // Every buffer the exponentiation needs is allocated here, once
+   const int n = size_;
+   Workspace work = makeWorkspace();
+   LimbVector power = residueLimbs(base);
+   if (montgomery_) {
+      multiply(power.data(), rSquared_.data(), power.data(), work);
+   }
+
+   // Longer exponents pay for a bigger table of odd powers with fewer multiplications
+   const int length = static_cast<int>(bits.size());
+   const int window = length < 8 ? 1 : length < 37 ? 2 : length < 141 ? 3 : length < 451 ? 4 :
+                      length < 1304 ? 5 : length < 3530 ? 6 : 7;
+   const int tableSize = 1 << (window - 1);
+   LimbVector table(static_cast<size_t>(tableSize) * n);   // base^1, base^3, ..., base^(2 * tableSize - 1)
+   std::copy(power.begin(), power.end(), table.begin());
+   if (tableSize > 1) {
+      LimbVector squared(n);
+      multiply(power.data(), power.data(), squared.data(), work);
+      for (int i = 1; i < tableSize; ++i) {
+         multiply(&table[(i - 1) * n], squared.data(), &table[i * n], work);
+      }
+   }
+
+   /* Scan the exponent from the top. A 0 bit squares the accumulator; a 1 bit
+      starts a window of up to window bits ending in a 1, which squares once per
+      bit and then multiplies in that window's odd power from the table. */
+   Limb* accumulator = power.data();
+   bool started{false};
+   int i = length - 1;
+   while (i >= 0) {
+      if (bits[i] == 0) {
+         multiply(accumulator, accumulator, accumulator, work);
+         --i;
+         continue;
+      }
+
+      int low = std::max(i - window + 1, 0);
+      while (bits[low] == 0) {
+         ++low;
+      }
+      int value{0};
+      for (int k = i; k >= low; --k) {
+         value = 2 * value + bits[k];
+      }
+      const Limb* entry = &table[(value >> 1) * n];
+      if (started) {
+         for (int k = i; k >= low; --k) {
+            multiply(accumulator, accumulator, accumulator, work);
+         }
+         multiply(accumulator, entry, accumulator, work);
+      } else {
+         std::copy(entry, entry + n, accumulator);
+         started = true;
+      }
+      i = low - 1;
+   }
+
+   // Leave Montgomery form by reducing the accumulator on its own
+   if (montgomery_) {
+      std::copy(accumulator, accumulator + n, work.limbs.begin());
+      std::fill(work.limbs.begin() + n, work.limbs.begin() + 2 * n + 1, 0);
+      montgomeryReduce(work.limbs.data(), accumulator, work.columns.data());
+   }
+   result.assignMagnitude(power, false);
+   return result;
+}
+
+/** multiply(const Limb*, const Limb*, Limb*, Workspace&)
+ * @brief   Multiplies two residues and reduces the product.
+ * @param   lhs      First residue, n limbs
+ * @param   rhs      Second residue, n limbs (may be lhs, to square)
+ * @param   result   Array to write the n-limb reduced product to (may be lhs or rhs)
+ * @param   work     Buffers from makeWorkspace()
+ * @post    result holds lhs * rhs in this context's form (Montgomery or plain).
+*/
+void ModularContext::multiply(const Limb* lhs, const Limb* rhs, Limb* result, Workspace& work) const {
+   // multiplyLimbs squares when both operands are the same array
+   Limb* wide = work.limbs.data();
+   InfiniteInt::multiplyLimbs(lhs, size_, rhs, size_, wide);
+   wide[2 * size_] = 0;
+   if (montgomery_) {
+      montgomeryReduce(wide, result, work.columns.data());
+   } else {
+      reducer_.reduceLimbs(wide, result, wide + 2 * size_ + 1);
+   }
+}
+
+/** montgomeryReduce(Limb*, Limb*, unsigned long long*)
+ * @brief   Divides a double-width number by kLimbBase^n modulo the modulus.
+ * @param   wide     The number, 2n + 1 limbs with the top one 0; overwritten
+ * @param   result   Array to write the n-limb result to
+ * @param   columns  Work space of 2n + 1 columns (used in decimal mode only)
+ * @pre     wide's number is less than modulus * kLimbBase^n.
+ * @post    result holds wide * kLimbBase^-n mod modulus.
+*/
+void ModularContext::montgomeryReduce(Limb* wide, Limb* result, unsigned long long* columns) const {
+   const int n = size_;
+
+   // Add the multiple of the modulus that clears each low limb in turn
+#ifdef INFINITEINT_BINARY
+   (void)columns;
+   for (int i = 0; i < n; ++i) {
+      const unsigned long long factor = static_cast<Limb>(wide[i] * inverse_);
+      unsigned long long carry{0};
+      for (int j = 0; j < n; ++j) {
+         unsigned long long current = factor * limbs_[j] + wide[i + j] + carry;
+         wide[i + j] = static_cast<Limb>(current);
+         carry = current >> 32;
+      }
+      for (int k = i + n; carry != 0; ++k) {
+         unsigned long long current = wide[k] + carry;
+         wide[k] = static_cast<Limb>(current);
+         carry = current >> 32;
+      }
+   }
+#else
+   /* Dividing by 10^9 costs far more than a multiply-add, so the rows are added
+      into 64-bit columns and carried only every kDeferredRows rows. Only the
+      column that picks the next row's factor is carried as the rows go by. */
+   std::copy(wide, wide + 2 * n + 1, columns);
+   for (int i = 0; i < n; ++i) {
+      const unsigned long long low = columns[i] % kLimbBase;
+      const unsigned long long factor = low * inverse_ % kLimbBase;
+      for (int j = 0; j < n; ++j) {
+         columns[i + j] += factor * limbs_[j];
+      }
+      columns[i + 1] += columns[i] / kLimbBase;
+
+      if ((i + 1) % InfiniteInt::kDeferredRows == 0 || i == n - 1) {
+         for (int k = i + 1; k < 2 * n; ++k) {
+            columns[k + 1] += columns[k] / kLimbBase;
+            wide[k] = static_cast<Limb>(columns[k] % kLimbBase);
+            columns[k] = wide[k];
+         }
+         wide[2 * n] = static_cast<Limb>(columns[2 * n]);
+      }
+   }
+#endif
+
+   // The low n limbs are now 0 and the high n + 1 are below twice the modulus
+   Limb* high = wide + n;
+   if (high[n] != 0 || InfiniteInt::compareLimbs(high, n, limbs_.data(), n) >= 0) {
+      InfiniteInt::subtractLimbsInPlace(high, n + 1, limbs_.data(), n);
+   }
+   std::copy(high, high + n, result);
+}
+
+/** makeWorkspace()
+ * @brief   Allocates the buffers multiply() needs.
+ * @return  Buffers sized for this context's modulus.
+*/
+ModularContext::Workspace ModularContext::makeWorkspace() const {
+   Workspace work;
+   const int product = 2 * size_ + 1;
+   if (montgomery_) {
+      work.limbs.resize(product);
+#ifndef INFINITEINT_BINARY
+      work.columns.resize(product);
+#endif
+   } else {
+      work.limbs.resize(product + reducer_.scratchSize());
+   }
+   return work;
+}
+
+/** setMontgomeryThreshold(int)
+ * @brief   Sets the modulus size from which contexts use Barrett reduction even
+ *          when Montgomery form is possible.
+ * @param   limbs    The new threshold, in limbs
+ * @pre     limbs >= 1.
+ * @post    Contexts constructed from now on use Montgomery form only for
+ *          moduli of fewer than limbs limbs.
+ * @throw   std::invalid_argument if limbs is less than 1.
+*/
+void ModularContext::setMontgomeryThreshold(int limbs) {
+   if (limbs < 1) {
+      throw std::invalid_argument("Montgomery threshold must be at least 1 limb.");
+   }
+   montgomeryThreshold_ = limbs;
+}
+
+/** montgomeryThreshold()
+ * @brief   Returns the modulus size from which contexts use Barrett reduction.
+ * @return  The current threshold, in limbs.
+*/
+int ModularContext::montgomeryThreshold() {
+   return montgomeryThreshold_;
+}
+
+/** residueLimbs(const InfiniteInt&)
+ * @brief   Reduces a number by the modulus into an n-limb array.
+ * @param   value    The number to reduce (may be negative)
+ * @return  value mod modulus, in [0, modulus), as n limbs lowest first.
+*/
+ModularContext::LimbVector ModularContext::residueLimbs(const InfiniteInt& value) const {
+   InfiniteInt residue = reducer_.reduce(value);
+   if (residue.isNegative_) {
+      residue += reducer_.modulus();
+   }
+   LimbVector limbs = residue.magnitudeLimbs();
+   limbs.resize(size_, 0);
+   return limbs;
+}
+
+/** exponentBits(const InfiniteInt&)
+ * @brief   Lists the binary digits of a non-negative number.
+ * @param   exponent The number to expand
+ * @return  The bits of exponent, lowest first, with no leading zeros.
+*/
+std::vector<unsigned char> ModularContext::exponentBits(const InfiniteInt& exponent) {
+   LimbVector limbs = exponent.magnitudeLimbs();
+   std::vector<unsigned char> bits;
+#ifdef INFINITEINT_BINARY
+   for (Limb limb : limbs) {
+      for (int bit = 0; bit < 32; ++bit) {
+         bits.push_back(static_cast<unsigned char>((limb >> bit) & 1));
+      }
+   }
+#else
+   // Peel off 29 bits at a time, since 2^29 is the largest power of 2 below a limb
+   const Limb kChunk = 1u << 29;
+   int size = static_cast<int>(limbs.size());
+   while (size > 0) {
+      Limb chunk = InfiniteInt::divideLimbsBySmall(limbs.data(), size, kChunk, limbs.data());
+      for (int bit = 0; bit < 29; ++bit) {
+         bits.push_back(static_cast<unsigned char>((chunk >> bit) & 1));
+      }
+      while (size > 0 && limbs[size - 1] == 0) {
+         --size;
+      }
+   }
+#endif
+   while (!bits.empty() && bits.back() == 0) {
+      bits.pop_back();
+   }
+   return bits;
+}
+
+/** powMod(const InfiniteInt&, const InfiniteInt&, const InfiniteInt&)
+ * @brief   Raises a number to a power modulo another number.
+ * @param   base       The number being raised
+ * @param   exponent   The power to raise base to
+ * @param   modulus    The number to reduce the result by
+ * @pre     exponent is not negative and modulus is positive.
+ * @return  InfiniteInt representing base^exponent mod modulus, in [0, modulus).
+ * @throw   std::domain_error if exponent is negative or modulus is not positive.
+*/
+InfiniteInt powMod(const InfiniteInt& base, const InfiniteInt& exponent, const InfiniteInt& modulus) {
+   return ModularContext(modulus).pow(base, exponent);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file ModularContext.h
+ * @brief Class definition for ModularContext, which holds the constants for
+ *    arithmetic modulo one fixed InfiniteInt so that many modular
+ *    exponentiations can share them
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+
+#ifndef MODULARCONTEXT_H
+#define MODULARCONTEXT_H
+
+#include "InfiniteInt.h"   // numbers being reduced, and the limb kernels that do the work
+#include "Reducer.h"       // Barrett reduction by the modulus
+#include <vector>          // std::vector
+
+/* Moduli that share no factor with the limb base (odd moduli in binary mode,
+   moduli ending in 1, 3, 7 or 9 in decimal mode) are worked in Montgomery
+   form, which replaces every division by limb multiplications. Its reduction
+   step is quadratic, though, so long moduli (and any modulus Montgomery form
+   cannot handle) use Barrett reduction with a precomputed reciprocal, whose
+   two multiplications go through operator*'s fast algorithms. Either way the
+   constants are computed once, in the constructor. */
+
+class ModularContext {
+public:
+   //PUBLIC METHODS
+   /** ModularContext(const InfiniteInt&)
+    * @brief   Constructor. Precomputes the constants for reducing by modulus.
+    * @param   modulus  The number that results are reduced by
+    * @pre     modulus is positive.
+    * @post    This context works modulo modulus.
+    * @throw   std::domain_error if modulus is not positive.
+   */
+   explicit ModularContext(const InfiniteInt& modulus);
+
+   /** modulus()
+    * @brief   Returns the number this context reduces by.
+    * @return  Reference to the modulus.
+   */
+   const InfiniteInt& modulus() const { return reducer_.modulus(); }
+
+   /** usesMontgomery()
+    * @brief   Reports whether this context works in Montgomery form.
+    * @return  true if the modulus shares no factor with the limb base and is
+    *          shorter than montgomeryThreshold(), false if it is reduced with
+    *          Barrett's method.
+   */
+   bool usesMontgomery() const { return montgomery_; }
+
+   /** pow(const InfiniteInt&, const InfiniteInt&)
+    * @brief   Raises a number to a power modulo this context's modulus, using
+    *          sliding-window exponentiation. The buffers for one call are
+    *          allocated once up front and reused by every step.
+    * @param   base        The number to raise (may be negative or not reduced)
+    * @param   exponent    The power to raise base to
+    * @pre     exponent is not negative.
+    * @post    This context is unchanged, so one context may be shared by threads,
+    *          and the result may be destroyed on any thread.
+    * @return  InfiniteInt representing base^exponent mod modulus(), in [0, modulus()).
+    * @throw   std::domain_error if exponent is negative.
+   */
+   InfiniteInt pow(const InfiniteInt& base, const InfiniteInt& exponent) const;
+
+   /** setMontgomeryThreshold(int)
+    * @brief   Sets the modulus size from which contexts use Barrett reduction even
+    *          when Montgomery form is possible. Contexts already constructed keep
+    *          the method they chose.
+    * @param   limbs    The new threshold, in limbs
+    * @pre     limbs >= 1.
+    * @post    Contexts constructed from now on use Montgomery form only for
+    *          moduli of fewer than limbs limbs.
+    * @throw   std::invalid_argument if limbs is less than 1.
+   */
+   static void setMontgomeryThreshold(int limbs);
+
+   /** montgomeryThreshold()
+    * @brief   Returns the modulus size from which contexts use Barrett reduction.
+    * @return  The current threshold, in limbs.
+   */
+   static int montgomeryThreshold();
+
+private:
+   // TYPES
+   typedef InfiniteInt::Limb Limb;               // a limb, as used by the flat-array kernels
+   typedef InfiniteInt::LimbVector LimbVector;   // a flat array of limbs, ordered from lowest to highest
+
+   /** Workspace
+    * @brief   Buffers for one exponentiation, shared by all of its multiplications.
+   */
+   struct Workspace {
+      LimbVector limbs;                          // the double-width product, then Barrett's estimates
+      std::vector<unsigned long long> columns;   // unnormalized columns for decimal Montgomery reduction
+   };
+
+   // CONSTANTS
+   static const unsigned long long kLimbBase = InfiniteInt::kLimbBase;
+
+   // DATA MEMBERS
+   Reducer reducer_;         // reduces by the modulus with Barrett's method
+   LimbVector limbs_;        // the modulus's limbs, lowest first, with no leading zero limbs
+   int size_;                // # of limbs in limbs_ (n)
+   bool montgomery_;         // true if residues are kept in Montgomery form
+   Limb inverse_;            // -modulus^-1 mod kLimbBase (Montgomery only)
+   LimbVector rSquared_;     // kLimbBase^(2n) mod modulus, n limbs (Montgomery only)
+
+   // CLASS MEMBERS
+   static int montgomeryThreshold_;   // moduli from this many limbs use Barrett reduction
+
+   //PRIVATE METHODS
+   /** multiply(const Limb*, const Limb*, Limb*, Workspace&)
+    * @brief   Multiplies two residues and reduces the product.
+    * @param   lhs      First residue, n limbs
+    * @param   rhs      Second residue, n limbs (may be lhs, to square)
+    * @param   result   Array to write the n-limb reduced product to (may be lhs or rhs)
+    * @param   work     Buffers from makeWorkspace()
+    * @post    result holds lhs * rhs in this context's form (Montgomery or plain).
+   */
+   void multiply(const Limb* lhs, const Limb* rhs, Limb* result, Workspace& work) const;
+
+   /** montgomeryReduce(Limb*, Limb*, unsigned long long*)
+    * @brief   Divides a double-width number by kLimbBase^n modulo the modulus.
+    * @param   wide     The number, 2n + 1 limbs with the top one 0; overwritten
+    * @param   result   Array to write the n-limb result to
+    * @param   columns  Work space of 2n + 1 columns (used in decimal mode only)
+    * @pre     wide's number is less than modulus * kLimbBase^n.
+    * @post    result holds wide * kLimbBase^-n mod modulus.
+   */
+   void montgomeryReduce(Limb* wide, Limb* result, unsigned long long* columns) const;
+
+   /** makeWorkspace()
+    * @brief   Allocates the buffers multiply() needs.
+    * @return  Buffers sized for this context's modulus.
+   */
+   Workspace makeWorkspace() const;
+
+   /** residueLimbs(const InfiniteInt&)
+    * @brief   Reduces a number by the modulus into an n-limb array.
+    * @param   value    The number to reduce (may be negative)
+    * @return  value mod modulus, in [0, modulus), as n limbs lowest first.
+   */
+   LimbVector residueLimbs(const InfiniteInt& value) const;
+
+   /** exponentBits(const InfiniteInt&)
+    * @brief   Lists the binary digits of a non-negative number.
+    * @param   exponent The number to expand
+    * @return  The bits of exponent, lowest first, with no leading zeros.
+   */
+   static std::vector<unsigned char> exponentBits(const InfiniteInt& exponent);
+};
+
+/** powMod(const InfiniteInt&, const InfiniteInt&, const InfiniteInt&)
+ * @brief   Raises a number to a power modulo another number. Callers with many
+ *          exponentiations by the same modulus should build one ModularContext
+ *          and call its pow() instead.
+ * @param   base       The number being raised
+ * @param   exponent   The power to raise base to
+ * @param   modulus    The number to reduce the result by
+ * @pre     exponent is not negative and modulus is positive.
+ * @return  InfiniteInt representing base^exponent mod modulus, in [0, modulus).
+ * @throw   std::domain_error if exponent is negative or modulus is not positive.
+*/
+InfiniteInt powMod(const InfiniteInt& base, const InfiniteInt& exponent, const InfiniteInt& modulus);
+
+#endif
@@ -0,0 +1,222 @@
+/**
+ * @file NodePool.cpp
+ * @brief Implementation for NodePool, a fixed-size block allocator that recycles
+ *    released blocks through a free list and refills itself one slab at a time
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+#include "NodePool.h"
+#include <stdexcept> // std::invalid_argument
+
+/** NodePool(std::size_t, int)
+ * @brief   Constructor. The calling thread becomes the pool's owner: its
+ *          allocations and releases take an unsynchronized fast path, while
+ *          those from any other thread go through a mutex.
+ * @param   blockSize      The size in bytes of every block handed out
+ * @param   blocksPerSlab  The number of blocks in each slab requested from the system
+ * @pre     blockSize > 0 and blocksPerSlab > 0.
+ * @post    The pool owns no slabs and all of its statistics are 0.
+ * @throw   std::invalid_argument if blockSize or blocksPerSlab is not positive.
+*/
+NodePool::NodePool(std::size_t blockSize, int blocksPerSlab)
+   : blockSize_(blockSize), blocksPerSlab_(blocksPerSlab), owner_(std::this_thread::get_id()),
+     references_(1), orphaned_(false), freeList_(nullptr), freeCount_(0), slab_(nullptr),
+     nextInSlab_(blocksPerSlab), hits_(0), misses_(0), sharedList_(nullptr), sharedCount_(0),
+     sharedSlab_(nullptr), nextInSharedSlab_(blocksPerSlab), sharedHits_(0), sharedMisses_(0) {
+   if (blockSize == 0 || blocksPerSlab <= 0) {
+      throw std::invalid_argument("NodePool needs a positive block size and blocks per slab.");
+   }
+
+   // Every block must be able to hold a FreeBlock and keep the next block aligned
+   const std::size_t align = alignof(std::max_align_t);
+   if (blockSize_ < sizeof(FreeBlock)) {
+      blockSize_ = sizeof(FreeBlock);
+   }
+   blockSize_ = (blockSize_ + align - 1) / align * align;
+}
+
+/** ~NodePool()
+ * @brief   Destructor.
+ * @pre     Every block allocated from this pool has been released.
+ * @post    All slabs have been returned to the system.
+*/
+NodePool::~NodePool() {
+   for (char* slab : slabs_) {
+      ::operator delete(slab);
+   }
+}
+
+/** allocate()
+ * @brief   Hands out one block, preferring the most recently released one.
+ * @post    The returned block is at least blockSize() bytes, suitably aligned for
+ *          any type, and counted as live until it is released. A new slab has
+ *          been allocated if neither the free lists nor the current slab had room.
+ *          May be called from any thread.
+ * @return  Pointer to the block.
+*/
+void* NodePool::allocate() {
+   // The block holds a reference, taken only once the block exists
+   void* block = obtainBlock();
+   references_.fetch_add(1, std::memory_order_relaxed);
+   return block;
+}
+
+/** obtainBlock()
+ * @brief   Takes one block from a free list or a slab, without counting it as a reference.
+ * @post    As for allocate(), except that the reference count is unchanged. If a
+ *          new slab was needed and could not be allocated, nothing has changed.
+ * @return  Pointer to the block.
+ * @throw   std::bad_alloc if a new slab could not be allocated.
+*/
+void* NodePool::obtainBlock() {
+   if (isOwnerThread()) {
+      // Once the owner's list runs dry, take over everything other threads released
+      if (freeList_ == nullptr && sharedCount_ != 0) {
+         std::lock_guard<std::mutex> lock(mutex_);
+         freeList_ = sharedList_;
+         freeCount_ = sharedCount_;
+         sharedList_ = nullptr;
+         sharedCount_ = 0;
+      }
+
+      // Recycle the most recently released block while it is likely still in cache
+      if (freeList_ != nullptr) {
+         FreeBlock* block = freeList_;
+         freeList_ = freeList_->next_;
+         --freeCount_;
+         ++hits_;
+         return block;
+      }
+
+      // Otherwise carve the next block from the owner's slab
+      void* block = carve(slab_, nextInSlab_);
+      ++misses_;
+      return block;
+   }
+
+   // Other threads share one list and slab behind the mutex
+   std::lock_guard<std::mutex> lock(mutex_);
+   if (sharedList_ != nullptr) {
+      FreeBlock* block = sharedList_;
+      sharedList_ = sharedList_->next_;
+      --sharedCount_;
+      ++sharedHits_;
+      return block;
+   }
+   void* block = carve(sharedSlab_, nextInSharedSlab_);
+   ++sharedMisses_;
+   return block;
+}
+
+/** release(void*)
+ * @brief   Returns a block to this pool's free list.
+ * @param   block    A block previously returned by allocate() on this pool
+ * @post    block is on a free list and will be handed out again. Blocks released
+ *          by other threads wait on a shared list until the owner next runs dry.
+ *          If the pool has been orphaned and this was its last reference, the
+ *          pool has deleted itself. May be called from any thread.
+*/
+void NodePool::release(void* block) {
+   FreeBlock* freed = static_cast<FreeBlock*>(block);
+   if (isOwnerThread()) {
+      freed->next_ = freeList_;
+      freeList_ = freed;
+      ++freeCount_;
+   } else {
+      std::lock_guard<std::mutex> lock(mutex_);
+      freed->next_ = sharedList_;
+      sharedList_ = freed;
+      ++sharedCount_;
+   }
+   dropReference();
+}
+
+/** attach()
+ * @brief   Records a user (e.g. a queue) that may allocate from this pool later,
+ *          so an orphaned pool is not deleted while the user holds no blocks.
+ * @post    The pool stays alive until a matching detach(). May be called from
+ *          any thread.
+*/
+void NodePool::attach() {
+   references_.fetch_add(1, std::memory_order_relaxed);
+}
+
+/** detach()
+ * @brief   Drops a user recorded by attach().
+ * @post    If the pool has been orphaned and this was its last reference, the
+ *          pool has deleted itself. May be called from any thread.
+*/
+void NodePool::detach() {
+   dropReference();
+}
+
+/** orphan()
+ * @brief   Gives up ownership of a pool allocated with new whose owner is going
+ *          away (e.g. a thread's default pool at thread exit).
+ * @pre     This pool was allocated with new, and orphan() is called by its owner.
+ * @post    If no blocks are live and no users are attached the pool has been
+ *          deleted. Otherwise it deletes itself when the last of them is released
+ *          or detached. From now on every thread takes the synchronized path.
+*/
+void NodePool::orphan() {
+   orphaned_.store(true, std::memory_order_release);
+   dropReference();
+}
+
+/** stats()
+ * @brief   Returns a snapshot of this pool's usage.
+ * @pre     Called by the owning thread, or while no other thread uses the pool.
+ * @return  The current statistics for this pool.
+*/
+NodePool::Stats NodePool::stats() const {
+   std::lock_guard<std::mutex> lock(mutex_);
+   const int freeNodes = freeCount_ + sharedCount_;
+   const long long misses = misses_ + sharedMisses_;
+   return Stats{ static_cast<int>(slabs_.size()), static_cast<int>(misses - freeNodes), freeNodes,
+                 hits_ + sharedHits_, misses };
+}
+
+/** isOwnerThread()
+ * @brief   Checks whether the calling thread may take the unsynchronized path.
+ * @return  True if the pool is not orphaned and the caller is its owner.
+*/
+bool NodePool::isOwnerThread() const {
+   // Only the owner sets orphaned_, so the owner always sees its own update
+   return !orphaned_.load(std::memory_order_relaxed) && std::this_thread::get_id() == owner_;
+}
+
+/** carve(char*&, int&)
+ * @brief   Carves the next never-used block from a slab, starting a new slab
+ *          if the current one is used up.
+ * @param   slab        The slab being carved (null if none yet)
+ * @param   nextInSlab  Index of the next never-used block in slab
+ * @pre     The caller either is the owner (for the owner's slab) or holds mutex_.
+ * @post    If a new slab was needed and could not be allocated, nothing has changed.
+ * @return  Pointer to the block.
+ * @throw   std::bad_alloc if a new slab could not be allocated.
+*/
+void* NodePool::carve(char*& slab, int& nextInSlab) {
+   if (nextInSlab == blocksPerSlab_) {
+      // The owner records its slabs under the mutex too, since stats() reads them
+      std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+      if (&slab == &slab_) {
+         lock.lock();
+      }
+
+      // Make room to record the slab first, so neither allocation can leak the other
+      slabs_.reserve(slabs_.size() + 1);
+      slab = static_cast<char*>(::operator new(blockSize_ * blocksPerSlab_));
+      slabs_.push_back(slab);
+      nextInSlab = 0;
+   }
+   return slab + blockSize_ * nextInSlab++;
+}
+
+/** dropReference()
+ * @brief   Gives up one reference, deleting the pool if it was the last.
+*/
+void NodePool::dropReference() {
+   if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+   }
+}
@@ -0,0 +1,184 @@
+/**
+ * @file NodePool.h
+ * @brief Class definition for NodePool, a fixed-size block allocator that recycles
+ *    released blocks through a free list and refills itself one slab at a time
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <atomic>    // reference count and orphaned flag shared between threads
+#include <cstddef>   // std::size_t and std::max_align_t
+#include <mutex>     // guards the slow path used by other threads
+#include <thread>    // std::thread::id of the owning thread
+#include <vector>    // list of slabs owned by the pool
+
+class NodePool {
+public:
+   /** Stats
+    * @brief   Snapshot of a pool's usage, for sizing slabs in production.
+   */
+   struct Stats {
+      int slabs;          // # of slabs allocated from the system
+      int liveNodes;      // # of blocks handed out and not yet released
+      int freeNodes;      // # of released blocks waiting on the free list
+      long long hits;     // # of allocations served by recycling a released block
+      long long misses;   // # of allocations that had to carve a fresh block from a slab
+   };
+
+   // CONSTANTS
+   static const int kDefaultBlocksPerSlab = 64;  // blocks carved from each slab by default
+
+   //PUBLIC METHODS
+   /** NodePool(std::size_t, int)
+    * @brief   Constructor. The calling thread becomes the pool's owner: its
+    *          allocations and releases take an unsynchronized fast path, while
+    *          those from any other thread go through a mutex.
+    * @param   blockSize      The size in bytes of every block handed out
+    * @param   blocksPerSlab  The number of blocks in each slab requested from the system
+    * @pre     blockSize > 0 and blocksPerSlab > 0.
+    * @post    The pool owns no slabs and all of its statistics are 0.
+    * @throw   std::invalid_argument if blockSize or blocksPerSlab is not positive.
+   */
+   explicit NodePool(std::size_t blockSize, int blocksPerSlab = kDefaultBlocksPerSlab);
+
+   /** ~NodePool()
+    * @brief   Destructor.
+    * @pre     Every block allocated from this pool has been released.
+    * @post    All slabs have been returned to the system.
+   */
+   ~NodePool();
+
+   /** allocate()
+    * @brief   Hands out one block, preferring the most recently released one.
+    * @post    The returned block is at least blockSize() bytes, suitably aligned for
+    *          any type, and counted as live until it is released. A new slab has
+    *          been allocated if neither the free lists nor the current slab had room.
+    *          May be called from any thread.
+    * @return  Pointer to the block.
+    * @throw   std::bad_alloc if a new slab was needed and could not be allocated,
+    *          in which case the pool is unchanged.
+   */
+   void* allocate();
+
+   /** release(void*)
+    * @brief   Returns a block to this pool's free list.
+    * @param   block    A block previously returned by allocate() on this pool
+    * @post    block is on a free list and will be handed out again. Blocks released
+    *          by other threads wait on a shared list until the owner next runs dry.
+    *          If the pool has been orphaned and this was its last reference, the
+    *          pool has deleted itself. May be called from any thread.
+   */
+   void release(void* block);
+
+   /** attach()
+    * @brief   Records a user (e.g. a queue) that may allocate from this pool later,
+    *          so an orphaned pool is not deleted while the user holds no blocks.
+    * @post    The pool stays alive until a matching detach(). May be called from
+    *          any thread.
+   */
+   void attach();
+
+   /** detach()
+    * @brief   Drops a user recorded by attach().
+    * @post    If the pool has been orphaned and this was its last reference, the
+    *          pool has deleted itself. May be called from any thread.
+   */
+   void detach();
+
+   /** orphan()
+    * @brief   Gives up ownership of a pool allocated with new whose owner is going
+    *          away (e.g. a thread's default pool at thread exit).
+    * @pre     This pool was allocated with new, and orphan() is called by its owner.
+    * @post    If no blocks are live and no users are attached the pool has been
+    *          deleted. Otherwise it deletes itself when the last of them is released
+    *          or detached. From now on every thread takes the synchronized path.
+   */
+   void orphan();
+
+   /** blockSize()
+    * @brief   Returns the size in bytes of the blocks handed out by this pool.
+    * @return  The block size, rounded up to a multiple of the maximum alignment.
+   */
+   std::size_t blockSize() const { return blockSize_; }
+
+   /** stats()
+    * @brief   Returns a snapshot of this pool's usage.
+    * @pre     Called by the owning thread, or while no other thread uses the pool.
+    * @return  The current statistics for this pool.
+   */
+   Stats stats() const;
+
+private:
+   /** FreeBlock
+    * @brief   Overlay for a released block, linking it into the free list.
+   */
+   struct FreeBlock {
+      FreeBlock* next_;   // the next block on the free list
+   };
+
+   /** isOwnerThread()
+    * @brief   Checks whether the calling thread may take the unsynchronized path.
+    * @return  True if the pool is not orphaned and the caller is its owner.
+   */
+   bool isOwnerThread() const;
+
+   /** obtainBlock()
+    * @brief   Takes one block from a free list or a slab, without counting it as a reference.
+    * @post    As for allocate(), except that the reference count is unchanged. If a
+    *          new slab was needed and could not be allocated, nothing has changed.
+    * @return  Pointer to the block.
+    * @throw   std::bad_alloc if a new slab could not be allocated.
+   */
+   void* obtainBlock();
+
+   /** carve(char*&, int&)
+    * @brief   Carves the next never-used block from a slab, starting a new slab
+    *          if the current one is used up.
+    * @param   slab        The slab being carved (null if none yet)
+    * @param   nextInSlab  Index of the next never-used block in slab
+    * @pre     The caller either is the owner (for the owner's slab) or holds mutex_.
+    * @post    If a new slab was needed and could not be allocated, nothing has changed.
+    * @return  Pointer to the block.
+    * @throw   std::bad_alloc if a new slab could not be allocated.
+   */
+   void* carve(char*& slab, int& nextInSlab);
+
+   /** dropReference()
+    * @brief   Gives up one reference, deleting the pool if it was the last.
+   */
+   void dropReference();
+
+   // DATA MEMBERS
+   std::size_t blockSize_;    // size of each block, rounded up for alignment
+   int blocksPerSlab_;        // # of blocks carved from each slab
+   std::thread::id owner_;    // thread that takes the unsynchronized path
+   std::atomic<int> references_;  // live blocks + attached users + 1 until orphaned
+   std::atomic<bool> orphaned_;   // true once the owner has called orphan()
+
+   // Used only by the owning thread
+   FreeBlock* freeList_;      // most recently released block (null if none)
+   int freeCount_;            // # of blocks on the free list
+   char* slab_;               // slab the owner carves from (null if none yet)
+   int nextInSlab_;           // index of the next never-used block in slab_
+   long long hits_;           // allocations served from a free list
+   long long misses_;         // allocations carved from slab memory
+
+   // Guarded by mutex_, for every other thread
+   mutable std::mutex mutex_;
+   std::vector<char*> slabs_; // every slab allocated by this pool
+   FreeBlock* sharedList_;    // blocks released by other threads (null if none)
+   std::atomic<int> sharedCount_;  // # of blocks on sharedList_ (the owner peeks without the mutex)
+   char* sharedSlab_;         // slab other threads carve from (null if none yet)
+   int nextInSharedSlab_;     // index of the next never-used block in sharedSlab_
+   long long sharedHits_;     // other threads' allocations served from sharedList_
+   long long sharedMisses_;   // other threads' allocations carved from slab memory
+
+   // Pools own raw memory, so they cannot be copied
+   NodePool(const NodePool&) = delete;
+   NodePool& operator=(const NodePool&) = delete;
+};
+
+#endif
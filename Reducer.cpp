@@ -0,0 +1,209 @@
+/**
+ * @file Reducer.cpp
+ * @brief Implementation for Reducer, which takes remainders by one fixed
+ *    InfiniteInt using Barrett's method with a reciprocal computed once
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+#include "Reducer.h"
+#include <algorithm>  // std::copy, std::fill, std::max and std::min
+#include <vector>     // std::vector
+#include <stdexcept>  // std::domain_error
+
+/** Reducer(const InfiniteInt&)
+ * @brief   Constructor. Precomputes the reciprocal of modulus.
+ * @param   modulus  The number that values are reduced by (may be negative)
+ * @pre     modulus does not represent zero.
+ * @post    This Reducer reduces by modulus.
+ * @throw   std::domain_error if modulus represents zero.
+*/
+Reducer::Reducer(const InfiniteInt& modulus) : modulus_(modulus), size_(0) {
+   if (modulus.isSmall_ && modulus.small_ == 0) {
+      throw std::domain_error("Reducer modulus must not be zero.");
+   }
+   limbs_ = modulus.magnitudeLimbs();
+   size_ = static_cast<int>(limbs_.size());
+
+   // reciprocal_ = floor(kLimbBase^(2n) / |modulus|), which has n + 1 or n + 2 limbs
+   LimbVector power(2 * size_ + 1, 0);
+   power[2 * size_] = 1;
+   LimbVector remainder(size_);
+   reciprocal_.resize(size_ + 2);
+   InfiniteInt::divideLimbs(power.data(), 2 * size_ + 1, limbs_.data(), size_,
+                            reciprocal_.data(), remainder.data());
+   while (reciprocal_.back() == 0) {
+      reciprocal_.pop_back();
+   }
+}
+
+/** reduce(const InfiniteInt&)
+ * @brief   Returns the remainder of dividing a number by the modulus.
+ * @param   value    The number to reduce (any size or sign)
+ * @post    This Reducer is unchanged, so several threads may reduce at once.
+ * @return  InfiniteInt equal to value % modulus(): it has the sign of value
+ *          (or is zero) and a magnitude less than the modulus's.
+*/
+InfiniteInt Reducer::reduce(const InfiniteInt& value) const {
+   // Hardware arithmetic handles inline numbers, shorter values are already
+   // reduced and one-limb moduli need only a single pass of short division
+   if (value.isSmall_ && modulus_.isSmall_) {
+      return value % modulus_;
+   }
+   LimbVector limbs = value.magnitudeLimbs();
+   const int n = size_;
+   const int length = static_cast<int>(limbs.size());
+   if (length < n) {
+      return value;
+   }
+
+   InfiniteInt result;        // value % modulus_
+   if (n == 1) {
+      const Limb remainder = InfiniteInt::divideLimbsBySmall(limbs.data(), length, limbs_[0], limbs.data());
+      result.assignMagnitude(LimbVector(1, remainder), value.isNegative_);
+      return result;
+   }
+
+   /* The first step reduces the top (up to) 2n limbs. Each later step puts the
+      remainder so far above the next n limbs down, which keeps every step's
+      number below kLimbBase^(2n), and reduces that. The remainder is written
+      straight into the high half of the next step's number. */
+   const int steps = length > 2 * n ? (length - n - 1) / n : 0;
+   const int top = length - steps * n;
+   LimbVector wide(2 * n, 0);
+   LimbVector scratch(scratchSize());
+   std::copy(limbs.end() - top, limbs.end(), wide.begin());
+   Limb* remainder = wide.data() + n;
+   reduceLimbs(wide.data(), remainder, scratch.data());
+   for (int step = steps - 1; step >= 0; --step) {
+      std::copy(limbs.begin() + step * n, limbs.begin() + (step + 1) * n, wide.begin());
+      reduceLimbs(wide.data(), remainder, scratch.data());
+   }
+
+   result.assignMagnitude(LimbVector(wide.begin() + n, wide.end()), value.isNegative_);
+   return result;
+}
+
+/** reduceLimbs(Limb*, Limb*, Limb*)
+ * @brief   Reduces a double-width magnitude by the modulus's.
+ * @param   wide     The number, 2n limbs; its low n + 1 limbs are overwritten
+ * @param   result   Array to write the n-limb remainder to (may overlap wide's
+ *                   high n limbs)
+ * @param   scratch  Work space of scratchSize() limbs
+ * @pre     wide's number is less than kLimbBase^(2n).
+ * @post    result holds wide mod |modulus|.
+*/
+void Reducer::reduceLimbs(Limb* wide, Limb* result, Limb* scratch) const {
+   const int n = size_;
+   const int reciprocalSize = static_cast<int>(reciprocal_.size());
+
+   /* Estimate the quotient from the top n + 1 limbs and the reciprocal. The
+      estimate is at most 2 below the true quotient, and the remainder is
+      below kLimbBase^(n+1), so only the low n + 1 limbs need subtracting.
+      Short moduli form just the product columns those two steps read, which
+      halves the schoolbook work and leaves the estimate at most 3 short. */
+   Limb* estimate = scratch;
+   Limb* quotient{nullptr};
+   Limb* multiple{nullptr};
+   if (n < 2 * InfiniteInt::karatsubaThreshold_) {
+      multiplyColumns(wide + n - 1, n + 1, reciprocal_.data(), reciprocalSize, n - 1,
+                      n + 1 + reciprocalSize, estimate);
+      quotient = estimate + 2;
+      multiple = estimate + reciprocalSize + 2;
+      multiplyColumns(quotient, n + 1, limbs_.data(), n, 0, n + 1, multiple);
+   } else {
+      InfiniteInt::multiplyLimbs(wide + n - 1, n + 1, reciprocal_.data(), reciprocalSize, estimate);
+      quotient = estimate + n + 1;
+      multiple = estimate + n + 1 + reciprocalSize;
+      InfiniteInt::multiplyLimbs(quotient, n + 1, limbs_.data(), n, multiple);
+   }
+
+   // subtractLimbsInPlace drops the final borrow, so this is exact modulo kLimbBase^(n+1)
+   InfiniteInt::subtractLimbsInPlace(wide, n + 1, multiple, n + 1);
+   while (InfiniteInt::compareLimbs(wide, n + 1, limbs_.data(), n) >= 0) {
+      InfiniteInt::subtractLimbsInPlace(wide, n + 1, limbs_.data(), n);
+   }
+   std::copy(wide, wide + n, result);
+}
+
+/** multiplyColumns(const Limb*, int, const Limb*, int, int, int, Limb*)
+ * @brief   Multiplies two limb arrays with the schoolbook method, forming only
+ *          the columns of the product in [from, to).
+ * @param   lhs      First factor, ordered from lowest limb to highest
+ * @param   lhsSize  # of limbs in lhs
+ * @param   rhs      Second factor, ordered from lowest limb to highest
+ * @param   rhsSize  # of limbs in rhs
+ * @param   from     Lowest column to form
+ * @param   to       One past the highest column to form
+ * @param   product  Array to write columns from to to - 1 to
+ * @pre     0 <= from < to and product has room for to - from limbs.
+ * @post    product holds the limb products that land in columns [from, to),
+ *          with their carries. If from is 0 that is exactly the product mod
+ *          kLimbBase^to; otherwise it can fall short of the true high part by
+ *          the carries out of the lower columns, at most from in its lowest limb.
+*/
+void Reducer::multiplyColumns(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize,
+                              int from, int to, Limb* product) {
+   const int width = to - from;
+#ifdef INFINITEINT_BINARY
+   // Binary limb products leave no headroom, so carry as each row is added
+   std::fill(product, product + width, 0);
+   for (int i = 0; i < rhsSize; ++i) {
+      const int first = std::max(0, from - i);
+      const int last = std::min(lhsSize, to - i);
+      const unsigned long long rhsLimb = rhs[i];
+      unsigned long long carry{0};
+      for (int j = first; j < last; ++j) {
+         unsigned long long current = product[i + j - from] + lhs[j] * rhsLimb + carry;
+         product[i + j - from] = static_cast<Limb>(current);
+         carry = current >> 32;
+      }
+      for (int k = i + last - from; carry != 0 && k < width; ++k) {
+         unsigned long long current = product[k] + carry;
+         product[k] = static_cast<Limb>(current);
+         carry = current >> 32;
+      }
+   }
+#else
+   // Decimal rows are added into 64-bit columns and carried every kDeferredRows rows
+   const int kStackColumns = 160;
+   unsigned long long stackColumns[kStackColumns];
+   std::vector<unsigned long long> heapColumns;
+   unsigned long long* columns = stackColumns;
+   if (width > kStackColumns) {
+      heapColumns.resize(width);
+      columns = heapColumns.data();
+   }
+   std::fill(columns, columns + width, 0);
+
+   for (int rowStart = 0; rowStart < rhsSize; rowStart += InfiniteInt::kDeferredRows) {
+      const int rowEnd = std::min(rhsSize, rowStart + InfiniteInt::kDeferredRows);
+      for (int i = rowStart; i < rowEnd; ++i) {
+         const int first = std::max(0, from - i);
+         const int last = std::min(lhsSize, to - i);
+         const unsigned long long rhsLimb = rhs[i];
+         for (int j = first; j < last; ++j) {
+            columns[i + j - from] += lhs[j] * rhsLimb;
+         }
+      }
+
+      unsigned long long carry{0};
+      for (int k = 0; k < width; ++k) {
+         unsigned long long current = columns[k] + carry;
+         columns[k] = current % kLimbBase;
+         carry = current / kLimbBase;
+      }
+   }
+   for (int k = 0; k < width; ++k) {
+      product[k] = static_cast<Limb>(columns[k]);
+   }
+#endif
+}
+
+/** scratchSize()
+ * @brief   Returns the work space reduceLimbs() needs.
+ * @return  The # of limbs to pass as reduceLimbs()'s scratch.
+*/
+int Reducer::scratchSize() const {
+   // The quotient estimate, then the multiple of the modulus
+   return (size_ + 1 + static_cast<int>(reciprocal_.size())) + (2 * size_ + 1);
+}
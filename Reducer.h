@@ -0,0 +1,102 @@
+/**
+ * @file Reducer.h
+ * @brief Class definition for Reducer, which takes remainders by one fixed
+ *    InfiniteInt using Barrett's method with a reciprocal computed once
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+
+#ifndef REDUCER_H
+#define REDUCER_H
+
+#include "InfiniteInt.h"   // numbers being reduced, and the limb kernels that do the work
+
+/* A Reducer divides by kLimbBase^(2n) / modulus, precomputed, instead of by the
+   modulus: each n limbs of the value cost two multiplications, which go through
+   operator*'s fast algorithms, rather than a long division. A Reducer is never
+   changed after construction, so one may be shared read-only between threads;
+   the numbers it returns may then be used and destroyed on any thread. */
+
+class Reducer {
+public:
+   //PUBLIC METHODS
+   /** Reducer(const InfiniteInt&)
+    * @brief   Constructor. Precomputes the reciprocal of modulus.
+    * @param   modulus  The number that values are reduced by (may be negative)
+    * @pre     modulus does not represent zero.
+    * @post    This Reducer reduces by modulus.
+    * @throw   std::domain_error if modulus represents zero.
+   */
+   explicit Reducer(const InfiniteInt& modulus);
+
+   /** modulus()
+    * @brief   Returns the number this Reducer reduces by.
+    * @return  Reference to the modulus.
+   */
+   const InfiniteInt& modulus() const { return modulus_; }
+
+   /** reduce(const InfiniteInt&)
+    * @brief   Returns the remainder of dividing a number by the modulus.
+    * @param   value    The number to reduce (any size or sign)
+    * @post    This Reducer is unchanged, so several threads may reduce at once.
+    * @return  InfiniteInt equal to value % modulus(): it has the sign of value
+    *          (or is zero) and a magnitude less than the modulus's.
+   */
+   InfiniteInt reduce(const InfiniteInt& value) const;
+
+private:
+   // TYPES
+   typedef InfiniteInt::Limb Limb;               // a limb, as used by the flat-array kernels
+   typedef InfiniteInt::LimbVector LimbVector;   // a flat array of limbs, ordered from lowest to highest
+
+   // CONSTANTS
+   static const unsigned long long kLimbBase = InfiniteInt::kLimbBase;
+
+   // DATA MEMBERS
+   InfiniteInt modulus_;     // the number values are reduced by
+   LimbVector limbs_;        // modulus_'s magnitude, lowest limb first, with no leading zero limbs
+   int size_;                // # of limbs in limbs_ (n)
+   LimbVector reciprocal_;   // floor(kLimbBase^(2n) / |modulus_|), with no leading zero limbs
+
+   //PRIVATE METHODS
+   /** reduceLimbs(Limb*, Limb*, Limb*)
+    * @brief   Reduces a double-width magnitude by the modulus's.
+    * @param   wide     The number, 2n limbs; its low n + 1 limbs are overwritten
+    * @param   result   Array to write the n-limb remainder to (may overlap wide's
+    *                   high n limbs)
+    * @param   scratch  Work space of scratchSize() limbs
+    * @pre     wide's number is less than kLimbBase^(2n).
+    * @post    result holds wide mod |modulus|.
+   */
+   void reduceLimbs(Limb* wide, Limb* result, Limb* scratch) const;
+
+   /** multiplyColumns(const Limb*, int, const Limb*, int, int, int, Limb*)
+    * @brief   Multiplies two limb arrays with the schoolbook method, forming only
+    *          the columns of the product in [from, to).
+    * @param   lhs      First factor, ordered from lowest limb to highest
+    * @param   lhsSize  # of limbs in lhs
+    * @param   rhs      Second factor, ordered from lowest limb to highest
+    * @param   rhsSize  # of limbs in rhs
+    * @param   from     Lowest column to form
+    * @param   to       One past the highest column to form
+    * @param   product  Array to write columns from to to - 1 to
+    * @pre     0 <= from < to and product has room for to - from limbs.
+    * @post    product holds the limb products that land in columns [from, to),
+    *          with their carries. If from is 0 that is exactly the product mod
+    *          kLimbBase^to; otherwise it can fall short of the true high part by
+    *          the carries out of the lower columns, at most from in its lowest limb.
+   */
+   static void multiplyColumns(const Limb* lhs, int lhsSize, const Limb* rhs, int rhsSize,
+                               int from, int to, Limb* product);
+
+   /** scratchSize()
+    * @brief   Returns the work space reduceLimbs() needs.
+    * @return  The # of limbs to pass as reduceLimbs()'s scratch.
+   */
+   int scratchSize() const;
+
+   // Allow modular exponentiation to reduce its products in place
+   friend class ModularContext;
+};
+
+#endif
@@ -8,6 +8,9 @@
 #include "catch.hpp"       // catch2 required header
 #include "../DEIntQueue.h" // class being tested
 #include <sstream>         // allow testing of queue contents via printing
+#include <thread>          // handing queues to another thread
+#include <vector>          // queues handed to another thread
+#include <utility>         // std::move
 
 // DEFAULT CONSTRUCTOR TESTS
 TEST_CASE("DEIntQueue constructor creates empty queue", "[DEIntQueue]") {
@@ -237,6 +240,189 @@ TEST_CASE("DEIntQueue::popBack throws an exception for an empty queue", "[DEIntQ
 }
 // END POP_BACK TESTS
 
+// GROWTH TESTS
+TEST_CASE("DEIntQueue keeps entries in order when pushes at both ends grow the buffer", "[DEIntQueue]") {
+   // Setup
+   std::stringstream expected;   // Expected output from queue
+   std::stringstream actual;     // Actual output from queue
+   DEIntQueue queue;
+   for (int i = 99; i >= 0; --i) {
+      expected << -i << ' ';
+   }
+   for (int i = 1; i < 100; ++i) {
+      expected << i << ' ';
+   }
+
+   // Run
+   for (int i = 0; i < 100; ++i) {
+      queue.pushFront(-i);
+      if (i > 0) {
+         queue.pushBack(i);
+      }
+   }
+   actual << queue;
+
+   // Test
+   CHECK(queue.numEntries() == 199);
+   CHECK(queue.front() == -99);
+   CHECK(queue.back() == 99);
+   CHECK(actual.str() == expected.str());
+}
+
+TEST_CASE("DEIntQueue keeps entries in order when pops and pushes wrap around the buffer", "[DEIntQueue]") {
+   // Setup
+   DEIntQueue queue;
+   for (int i = 0; i < 6; ++i) {
+      queue.pushBack(i);
+   }
+
+   // Run
+   for (int i = 6; i < 50; ++i) {
+      queue.popFront();
+      queue.pushBack(i);
+   }
+
+   // Test
+   CHECK(queue.numEntries() == 6);
+   int expected = 44;
+   for (auto iter = queue.begin(); iter != queue.end(); ++iter) {
+      CHECK(*iter == expected);
+      ++expected;
+   }
+}
+
+TEST_CASE("DEIntQueue::reserve keeps the existing entries", "[DEIntQueue]") {
+   // Setup
+   std::stringstream expected{"3 1 2 "};  // Expected output from queue
+   std::stringstream actual;              // Actual output from queue
+   DEIntQueue queue;
+   queue.pushBack(1);
+   queue.pushBack(2);
+   queue.pushFront(3);
+
+   // Run
+   queue.reserve(1000);
+   actual << queue;
+
+   // Test
+   CHECK(queue.numEntries() == 3);
+   CHECK(actual.str() == expected.str());
+}
+
+TEST_CASE("DEIntQueue::clear empties the queue so it can be refilled", "[DEIntQueue]") {
+   // Setup
+   std::stringstream expected{"7 "};   // Expected output from queue
+   std::stringstream actual;           // Actual output from queue
+   DEIntQueue queue;
+   for (int i = 0; i < 20; ++i) {
+      queue.pushFront(i);
+   }
+
+   // Run
+   queue.clear();
+   queue.pushBack(7);
+   actual << queue;
+
+   // Test
+   CHECK(queue.numEntries() == 1);
+   CHECK(actual.str() == expected.str());
+}
+// END GROWTH TESTS
+
+#ifdef DEINTQUEUE_UNROLLED
+// NODE POOL TESTS
+TEST_CASE("DEIntQueue recycles Nodes released by other queues", "[DEIntQueue]") {
+   // Setup
+   NodePool pool(DEIntQueue::nodeSize(), 4);
+   {
+      DEIntQueue temporary(pool);
+      for (int i = 0; i < 1000; ++i) {
+         temporary.pushFront(i);
+      }
+   }
+   NodePool::Stats before = pool.stats();
+   REQUIRE(before.liveNodes == 0);
+   REQUIRE(before.freeNodes > 0);
+
+   // Run
+   DEIntQueue queue(pool);
+   for (int i = 0; i < 1000; ++i) {
+      queue.pushBack(i);
+   }
+   NodePool::Stats after = pool.stats();
+
+   // Test
+   CHECK(after.slabs == before.slabs);
+   CHECK(after.misses == before.misses);
+   CHECK(after.hits > before.hits);
+   CHECK(after.liveNodes == before.freeNodes);
+   CHECK(queue.front() == 0);
+   CHECK(queue.back() == 999);
+}
+
+TEST_CASE("DEIntQueue rejects a NodePool whose blocks cannot hold a Node", "[DEIntQueue]") {
+   // Setup
+   NodePool pool(8, 4);
+
+   // Test
+   CHECK_THROWS_AS(DEIntQueue(pool), std::invalid_argument);
+}
+
+TEST_CASE("DEIntQueue takes its first Node from the pool of the thread that fills it", "[DEIntQueue]") {
+   // Setup
+   DEIntQueue queue;
+   int workerLiveNodes{-1};
+
+   // Run - the queue is filled, and its Nodes allocated, on a thread that then exits
+   std::thread worker([&queue, &workerLiveNodes]() {
+      const int liveBefore = DEIntQueue::threadNodePool().stats().liveNodes;
+      for (int i = 0; i < 3 * DEINTQUEUE_NODE_CAPACITY; ++i) {
+         queue.pushBack(i);
+      }
+      workerLiveNodes = DEIntQueue::threadNodePool().stats().liveNodes - liveBefore;
+   });
+   worker.join();
+
+   // Test (the orphaned pool stays alive until the queue is destroyed here,
+   // which a leak or use after free would show under valgrind)
+   CHECK(workerLiveNodes == 3);
+   CHECK(queue.numEntries() == 3 * DEINTQUEUE_NODE_CAPACITY);
+   CHECK(queue.front() == 0);
+   CHECK(queue.back() == 3 * DEINTQUEUE_NODE_CAPACITY - 1);
+}
+
+TEST_CASE("DEIntQueue can be moved to and destroyed on another thread", "[DEIntQueue]") {
+   // Setup
+   std::vector<DEIntQueue> queues(50);
+   for (DEIntQueue& queue : queues) {
+      for (int i = 0; i < 200; ++i) {
+         queue.pushBack(i);
+      }
+   }
+
+   // Run - another thread grows and then frees the queues while this one keeps allocating
+   std::thread worker([](std::vector<DEIntQueue> moved) {
+      for (DEIntQueue& queue : moved) {
+         queue.pushFront(-1);
+      }
+      moved.clear();
+   }, std::move(queues));
+   DEIntQueue local;
+   for (int i = 0; i < 20000; ++i) {
+      local.pushBack(i);
+      if (i % 3 == 0) {
+         local.popFront();
+      }
+   }
+   worker.join();
+
+   // Test
+   CHECK(local.numEntries() == 13333);
+   CHECK(local.back() == 19999);
+}
+// END NODE POOL TESTS
+#endif
+
 // BIG THREE TESTS
 TEST_CASE("DEIntQueue Copy constructor deep copies another queue", "[DEIntQueue]") {
    // Setup
@@ -440,6 +626,77 @@ TEST_CASE("DEIntQueue assignment operator deep copies another queue", "[DEIntQue
       CHECK(originalBeforeChange.str() == originalAfterChange.str());
    }
 }
+
+TEST_CASE("DEIntQueue move constructor takes over another queue's entries", "[DEIntQueue]") {
+   // Setup
+   std::stringstream expected{"3 1 2 "};  // Expected output from queue
+   std::stringstream actual;              // Actual output from queue
+   DEIntQueue original;
+   original.pushBack(1);
+   original.pushBack(2);
+   original.pushFront(3);
+
+   // Run
+   DEIntQueue moved(std::move(original));
+   actual << moved;
+
+   // Test
+   CHECK(moved.numEntries() == 3);
+   CHECK(actual.str() == expected.str());
+   CHECK(original.numEntries() == 0);
+   CHECK(original.begin() == original.end());
+}
+
+TEST_CASE("DEIntQueue move assignment takes over another queue's entries", "[DEIntQueue]") {
+   // Setup
+   std::stringstream expected{"4 5 "};   // Expected output from queue
+   std::stringstream actual;             // Actual output from queue
+   DEIntQueue original;
+   original.pushBack(4);
+   original.pushBack(5);
+   DEIntQueue target;
+   for (int i = 0; i < 100; ++i) {
+      target.pushBack(i);
+   }
+
+   // Run
+   target = std::move(original);
+   actual << target;
+
+   // Test
+   CHECK(target.numEntries() == 2);
+   CHECK(actual.str() == expected.str());
+   CHECK(original.numEntries() == 0);
+
+   // The moved-from queue is still usable
+   original.pushFront(9);
+   CHECK(original.front() == 9);
+}
+
+TEST_CASE("DEIntQueue::swap exchanges the entries of two queues", "[DEIntQueue]") {
+   // Setup
+   std::stringstream expectedA{"7 8 9 "};  // Expected output from queueA
+   std::stringstream expectedB{"1 "};      // Expected output from queueB
+   std::stringstream actualA;
+   std::stringstream actualB;
+   DEIntQueue queueA;
+   DEIntQueue queueB;
+   queueA.pushBack(1);
+   queueB.pushBack(7);
+   queueB.pushBack(8);
+   queueB.pushBack(9);
+
+   // Run
+   swap(queueA, queueB);
+   actualA << queueA;
+   actualB << queueB;
+
+   // Test
+   CHECK(actualA.str() == expectedA.str());
+   CHECK(actualB.str() == expectedB.str());
+   CHECK(queueA.numEntries() == 3);
+   CHECK(queueB.numEntries() == 1);
+}
 // END BIG THREE TESTS
 
 // ITERATOR TESTS
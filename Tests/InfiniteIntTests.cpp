@@ -7,7 +7,31 @@
 
 #include "catch.hpp"          // catch2 required header
 #include "../InfiniteInt.h"   // class being tested
+#include "TestHelpers.h"      // readInfiniteInt, printInfiniteInt and pseudoRandomDigits
+#include <algorithm>          // std::min
 #include <sstream>            // allow testing of InfiniteInt contents via printing
+#include <utility>            // std::move
+
+// Restores every algorithm threshold when a test finishes, even if it fails
+struct ThresholdGuard {
+   int karatsuba = InfiniteInt::karatsubaThreshold();
+   int toom3 = InfiniteInt::toom3Threshold();
+   int unbalancedToom = InfiniteInt::unbalancedToomThreshold();
+   int ntt = InfiniteInt::nttThreshold();
+   int burnikelZiegler = InfiniteInt::burnikelZieglerThreshold();
+   int newton = InfiniteInt::newtonDivisionThreshold();
+   int halfGcd = InfiniteInt::halfGcdThreshold();
+
+   ~ThresholdGuard() {
+      InfiniteInt::setKaratsubaThreshold(karatsuba);
+      InfiniteInt::setToom3Threshold(toom3);
+      InfiniteInt::setUnbalancedToomThreshold(unbalancedToom);
+      InfiniteInt::setNttThreshold(ntt);
+      InfiniteInt::setBurnikelZieglerThreshold(burnikelZiegler);
+      InfiniteInt::setNewtonDivisionThreshold(newton);
+      InfiniteInt::setHalfGcdThreshold(halfGcd);
+   }
+};
 
 // CONSTRUCTOR TESTS
 TEST_CASE("[InfiniteInt] Default constructor creates an InfiniteInt representing 0", "[InfiniteInt constructors]") {
@@ -115,6 +139,71 @@ TEST_CASE("[InfiniteInt] Operator= performs a deep copy", "[InfiniteInt deep cop
    testAssignment("Original < 0 with > 1 digit", 321, -123456, -123);
    testAssignment("Original = 0", 123, -9, 0);
 }
+
+TEST_CASE("[InfiniteInt] Move constructor takes over the digits of another InfiniteInt", "[InfiniteInt deep copy]") {
+   // Setup
+   std::stringstream actual;
+   InfiniteInt original(-123456);
+
+   // Run
+   InfiniteInt moved(std::move(original));
+   actual << moved;
+
+   // Test
+   CHECK(actual.str() == "-123456");
+   CHECK(moved.numDigits() == 6);
+
+   // The moved-from InfiniteInt can be assigned to again
+   original = InfiniteInt(42);
+   CHECK(original == InfiniteInt(42));
+}
+
+TEST_CASE("[InfiniteInt] Move constructor leaves the moved-from InfiniteInt representing 0", "[InfiniteInt deep copy]") {
+   // Setup: one value held inline and one too large to be held inline
+   std::stringstream actual;
+   InfiniteInt small(-123456);
+   InfiniteInt large = InfiniteInt(1000000000) * InfiniteInt(1000000000) * InfiniteInt(-1000000000);
+
+   // Run
+   InfiniteInt movedSmall(std::move(small));
+   InfiniteInt movedLarge(std::move(large));
+   actual << large;
+
+   // Test
+   CHECK(movedSmall == InfiniteInt(-123456));
+   CHECK(movedLarge == InfiniteInt(1000000000) * InfiniteInt(1000000000) * InfiniteInt(-1000000000));
+   CHECK(small == InfiniteInt(0));
+   CHECK(large == InfiniteInt(0));
+   CHECK(actual.str() == "0");
+   CHECK(large.numDigits() == 1);
+   CHECK(large + InfiniteInt(7) == InfiniteInt(7));
+}
+
+TEST_CASE("[InfiniteInt] Move assignment takes over the digits of another InfiniteInt", "[InfiniteInt deep copy]") {
+   // Setup
+   InfiniteInt target(987);
+   InfiniteInt original(-654321);
+
+   // Run
+   target = std::move(original);
+
+   // Test
+   CHECK(target == InfiniteInt(-654321));
+   CHECK(target.numDigits() == 6);
+}
+
+TEST_CASE("[InfiniteInt] Swap exchanges the values of two InfiniteInts", "[InfiniteInt deep copy]") {
+   // Setup
+   InfiniteInt first(-12);
+   InfiniteInt second(3456);
+
+   // Run
+   swap(first, second);
+
+   // Test
+   CHECK(first == InfiniteInt(3456));
+   CHECK(second == InfiniteInt(-12));
+}
 // END DEEP COPY TESTS
 
 // OPERATOR INT TESTS
@@ -269,6 +358,36 @@ TEST_CASE("[InfiniteInt] Less than operator returns false when # of digits diffe
    testLessThan("Both < 0, lhs has more digits", InfiniteInt(-123456), InfiniteInt(-12345), true);
    testLessThan("Both < 0, rhs has more digits", InfiniteInt(-45678), InfiniteInt(-456789), false);
 }
+
+// Checks compare() and every relational operator against the expected ordering
+void testOrdering(const InfiniteInt& lhs, const InfiniteInt& rhs, int expectedOrder) {
+   CHECK(lhs.compare(rhs) == expectedOrder);
+   CHECK(rhs.compare(lhs) == -expectedOrder);
+   CHECK((lhs == rhs) == (expectedOrder == 0));
+   CHECK((lhs != rhs) == (expectedOrder != 0));
+   CHECK((lhs < rhs) == (expectedOrder < 0));
+   CHECK((lhs <= rhs) == (expectedOrder <= 0));
+   CHECK((lhs > rhs) == (expectedOrder > 0));
+   CHECK((lhs >= rhs) == (expectedOrder >= 0));
+}
+
+TEST_CASE("[InfiniteInt] compare and the relational operators agree on inline and multi-limb numbers", "[InfiniteInt]") {
+   InfiniteInt big = InfiniteInt(1000000000) * InfiniteInt(1000000000) * InfiniteInt(1000000000);
+   InfiniteInt bigger = big + InfiniteInt(1);
+   InfiniteInt negativeBig = InfiniteInt(0) - big;
+
+   testOrdering(InfiniteInt(0), InfiniteInt(0), 0);
+   testOrdering(InfiniteInt(-5), InfiniteInt(3), -1);
+   testOrdering(InfiniteInt(-5), InfiniteInt(-3), -1);
+   testOrdering(InfiniteInt(7), InfiniteInt(7), 0);
+   testOrdering(big, big * InfiniteInt(1), 0);
+   testOrdering(big, bigger, -1);
+   testOrdering(InfiniteInt(0) - bigger, negativeBig, -1);
+   testOrdering(negativeBig, InfiniteInt(-1), -1);
+   testOrdering(negativeBig, big, -1);
+   testOrdering(big, InfiniteInt(2147483647), 1);
+   testOrdering(big * big, bigger, 1);
+}
 // END LESS THAN TESTS
 
 // SUBTRACTION TESTS
@@ -439,4 +558,1020 @@ TEST_CASE("[InfiniteInt] Operator>> sets the InfiniteInt to zero for bad inputs"
    testStreamInput("First character after whitespace is non-digit", " z1234", InfiniteInt(456), "0", 1);
    testStreamInput("Minus sign followed by non-digit", "--1234", InfiniteInt(456), "0", 0);
 }
-// END OPERATOR>> TESTS
\ No newline at end of file
+
+TEST_CASE("[InfiniteInt] Operator>> reads a lone minus sign or negative zero as zero", "[InfiniteInt operator>>]") {
+   testStreamInput("Minus sign followed by whitespace", "- 12", InfiniteInt(456), "0", 0);
+   testStreamInput("Negative zero", "-0", InfiniteInt(456), "0", -1);
+   testStreamInput("Negative zeroes followed by a letter", "-000x", InfiniteInt(456), "0", 4);
+}
+// END OPERATOR>> TESTS
+
+// LIMB BOUNDARY TESTS
+TEST_CASE("[InfiniteInt] Carries and borrows propagate across limbs", "[InfiniteInt limbs]") {
+   CHECK(printInfiniteInt(readInfiniteInt("999999999999999999") + InfiniteInt(1)) == "1000000000000000000");
+   CHECK(printInfiniteInt(readInfiniteInt("1000000000000000000") - InfiniteInt(1)) == "999999999999999999");
+   CHECK(printInfiniteInt(InfiniteInt(1) - readInfiniteInt("1000000000000000000")) == "-999999999999999999");
+   CHECK(printInfiniteInt(readInfiniteInt("-1000000000") + InfiniteInt(999999999)) == "-1");
+}
+
+TEST_CASE("[InfiniteInt] Mixed-sign addition of multi-limb numbers picks the larger magnitude", "[InfiniteInt limbs]") {
+   InfiniteInt big = readInfiniteInt("123456789123456789123456789123456789");
+   InfiniteInt close = readInfiniteInt("123456789123456789123456789123456788");
+   InfiniteInt negativeBig = InfiniteInt(0) - big;
+   InfiniteInt negativeClose = InfiniteInt(0) - close;
+
+   CHECK(printInfiniteInt(big + negativeClose) == "1");
+   CHECK(printInfiniteInt(close + negativeBig) == "-1");
+   CHECK(printInfiniteInt(negativeBig + close) == "-1");
+   CHECK(printInfiniteInt(negativeClose + big) == "1");
+   CHECK(printInfiniteInt(big + negativeBig) == "0");
+   CHECK(printInfiniteInt(negativeBig - negativeBig) == "0");
+   CHECK(printInfiniteInt(negativeBig - negativeClose) == "-1");
+   CHECK(printInfiniteInt(readInfiniteInt("-1000000000000000000000000000") + readInfiniteInt("999999999999999999")) ==
+         "-999999999000000000000000001");
+   CHECK(printInfiniteInt(readInfiniteInt("999999999999999999") - readInfiniteInt("1000000000000000000000000000")) ==
+         "-999999999000000000000000001");
+   CHECK((big + negativeClose) == InfiniteInt(1));
+   CHECK((big - big) == InfiniteInt(0));
+}
+
+TEST_CASE("[InfiniteInt] Limbs with leading zeroes are printed and counted as full width", "[InfiniteInt limbs]") {
+   InfiniteInt ii = readInfiniteInt("1000000000000000007");
+
+   CHECK(printInfiniteInt(ii) == "1000000000000000007");
+   CHECK(ii.numDigits() == 19);
+   CHECK(readInfiniteInt("999999999").numDigits() == 9);
+   CHECK(readInfiniteInt("1000000000").numDigits() == 10);
+}
+
+TEST_CASE("[InfiniteInt] Digit counts are exact on either side of powers of ten", "[InfiniteInt limbs]") {
+   for (int k : { 1, 9, 10, 18, 19, 20, 38, 39, 96, 97, 300, 1000, 1001 }) {
+      INFO("k = " << k);
+      InfiniteInt power = InfiniteInt(10).pow(k);
+      CHECK((power - InfiniteInt(1)).numDigits() == k);
+      CHECK(power.numDigits() == k + 1);
+      CHECK((power + InfiniteInt(1)).numDigits() == k + 1);
+      CHECK((InfiniteInt(0) - power).numDigits() == k + 1);
+      CHECK((power * InfiniteInt(10) - InfiniteInt(1)).numDigits() == k + 1);
+   }
+}
+
+TEST_CASE("[InfiniteInt] Printing pads limbs with zeroes regardless of the stream's fill", "[InfiniteInt limbs]") {
+   std::stringstream output;
+   output.fill('*');
+   output << readInfiniteInt("-3000000000000000004");
+   CHECK(output.str() == "-3000000000000000004");
+}
+
+TEST_CASE("[InfiniteInt] Multiplication carries across limbs", "[InfiniteInt limbs]") {
+   InfiniteInt nines = readInfiniteInt("999999999999999999999999999");
+
+   CHECK(printInfiniteInt(nines * nines) == "999999999999999999999999998000000000000000000000000001");
+   CHECK(printInfiniteInt(readInfiniteInt("1000000000") * readInfiniteInt("-1000000000")) == "-1000000000000000000");
+}
+
+TEST_CASE("[InfiniteInt] Values around powers of two are exact in every limb base", "[InfiniteInt limbs]") {
+   InfiniteInt twoTo32 = readInfiniteInt("4294967296");
+
+   CHECK(printInfiniteInt(twoTo32 - InfiniteInt(1)) == "4294967295");
+   CHECK(printInfiniteInt(twoTo32 * twoTo32) == "18446744073709551616");
+   CHECK(printInfiniteInt(twoTo32 * twoTo32 - InfiniteInt(1)) == "18446744073709551615");
+   CHECK((twoTo32 * twoTo32).numDigits() == 20);
+   CHECK(readInfiniteInt("2147483648") < readInfiniteInt("4294967295"));
+}
+
+TEST_CASE("[InfiniteInt] Comparison looks at every limb", "[InfiniteInt limbs]") {
+   CHECK(readInfiniteInt("1000000000000000001") == readInfiniteInt("1000000000000000001"));
+   CHECK_FALSE(readInfiniteInt("1000000000000000001") == readInfiniteInt("1000000001000000001"));
+   CHECK(readInfiniteInt("1000000000000000001") < readInfiniteInt("1000000001000000001"));
+   CHECK(readInfiniteInt("-1000000001000000001") < readInfiniteInt("-1000000000000000001"));
+   CHECK(readInfiniteInt("999999999") < readInfiniteInt("1000000000"));
+}
+// END LIMB BOUNDARY TESTS
+
+// BUFFERED INPUT TESTS
+TEST_CASE("[InfiniteInt] Operator>> reads one number after another until the stream ends", "[InfiniteInt operator>>]") {
+   std::stringstream inputStream(" 12 -345678901234567890123\n0 999999999999");
+   std::string printed;
+   InfiniteInt ii;
+   while (inputStream >> ii) {
+      printed += printInfiniteInt(ii) + ",";
+   }
+
+   CHECK(printed == "12,-345678901234567890123,0,999999999999,");
+   CHECK(inputStream.eof());
+}
+
+// A stream buffer that hands out its text a few characters at a time
+class TrickleBuffer : public std::streambuf {
+public:
+   TrickleBuffer(const std::string& text, int step) : text_(text), step_(step), end_(0) { }
+
+protected:
+   int_type underflow() override {
+      if (end_ >= static_cast<int>(text_.size())) {
+         return traits_type::eof();
+      }
+      const int start = end_;
+      end_ = std::min(static_cast<int>(text_.size()), end_ + step_);
+      setg(&text_[0], &text_[0] + start, &text_[0] + end_);
+      return traits_type::to_int_type(text_[start]);
+   }
+
+private:
+   std::string text_;
+   int step_;
+   int end_;
+};
+
+TEST_CASE("[InfiniteInt] Operator>> reads long numbers exactly", "[InfiniteInt operator>>]") {
+   for (int numDigits : { 1, 8, 9, 10, 17, 18, 19, 100, 1151, 1152, 1153, 2305, 5000, 20000 }) {
+      const std::string digits = pseudoRandomDigits(numDigits, static_cast<unsigned>(numDigits));
+      INFO(numDigits << " digits");
+
+      std::stringstream inputStream(digits + "x-1");
+      InfiniteInt ii;
+      inputStream >> ii;
+      CHECK(printInfiniteInt(ii) == digits);
+      CHECK(inputStream.get() == 'x');
+
+      CHECK(readInfiniteInt("-" + digits) == InfiniteInt(0) - ii);
+      CHECK(readInfiniteInt("1" + std::string(numDigits, '0')) == InfiniteInt(10).pow(numDigits));
+   }
+}
+
+TEST_CASE("[InfiniteInt] Long numbers print every run of zero and nine chunks", "[InfiniteInt limbs]") {
+   for (int k : { 1152, 1153, 2304, 5000, 20000 }) {
+      INFO("k = " << k);
+      InfiniteInt power = InfiniteInt(10).pow(k);
+      CHECK(printInfiniteInt(power) == "1" + std::string(k, '0'));
+      CHECK(printInfiniteInt(power - InfiniteInt(1)) == std::string(k, '9'));
+      CHECK(printInfiniteInt(InfiniteInt(0) - power - InfiniteInt(7)) == "-1" + std::string(k - 1, '0') + "7");
+      CHECK(printInfiniteInt(power * power + power) == "1" + std::string(k - 1, '0') + "1" + std::string(k, '0'));
+   }
+}
+
+TEST_CASE("[InfiniteInt] Operator>> reads numbers split across the stream's buffer refills", "[InfiniteInt operator>>]") {
+   std::string digits;
+   for (int i = 0; i < 3000; ++i) {
+      digits.push_back(static_cast<char>('0' + (i * 7 + i / 10) % 10));
+   }
+   digits[0] = '4';
+
+   for (int step : { 1, 2, 7, 64, 4097 }) {
+      INFO("Refilling " << step << " characters at a time");
+      TrickleBuffer buffer("  -" + digits + " 25", step);
+      std::istream inputStream(&buffer);
+      InfiniteInt first;
+      InfiniteInt second;
+      inputStream >> first >> second;
+
+      CHECK(printInfiniteInt(first) == "-" + digits);
+      CHECK(printInfiniteInt(second) == "25");
+      CHECK(inputStream.eof());
+      CHECK_FALSE(inputStream.fail());
+   }
+}
+
+// A stream buffer with no get area that still reports how much text is left
+class UnbufferedBuffer : public std::streambuf {
+public:
+   explicit UnbufferedBuffer(const std::string& text) : text_(text), next_(0) { }
+
+protected:
+   std::streamsize showmanyc() override {
+      return static_cast<std::streamsize>(text_.size() - next_);
+   }
+
+   int_type underflow() override {
+      return next_ < text_.size() ? traits_type::to_int_type(text_[next_]) : traits_type::eof();
+   }
+
+   int_type uflow() override {
+      return next_ < text_.size() ? traits_type::to_int_type(text_[next_++]) : traits_type::eof();
+   }
+
+private:
+   std::string text_;
+   std::size_t next_;
+};
+
+TEST_CASE("[InfiniteInt] Operator>> reads from a buffer with no get area without losing characters", "[InfiniteInt operator>>]") {
+   UnbufferedBuffer buffer("-123456789012345678901234567890x 42");
+   std::istream inputStream(&buffer);
+   InfiniteInt first;
+   inputStream >> first;
+
+   CHECK(printInfiniteInt(first) == "-123456789012345678901234567890");
+   CHECK_FALSE(inputStream.fail());
+   CHECK(inputStream.get() == 'x');
+
+   InfiniteInt second;
+   inputStream >> second;
+   CHECK(printInfiniteInt(second) == "42");
+   CHECK(inputStream.eof());
+}
+// END BUFFERED INPUT TESTS
+
+// INLINE VALUE TESTS
+TEST_CASE("[InfiniteInt] Arithmetic spills past the long long range and comes back", "[InfiniteInt inline]") {
+   InfiniteInt max = readInfiniteInt("9223372036854775807");
+   InfiniteInt beyondMax = max + InfiniteInt(1);
+
+   CHECK(printInfiniteInt(beyondMax) == "9223372036854775808");
+   CHECK(beyondMax.numDigits() == 19);
+   CHECK(beyondMax - InfiniteInt(1) == max);
+   CHECK(printInfiniteInt(InfiniteInt(-1) - max) == "-9223372036854775808");
+   CHECK(InfiniteInt(-1) - max + InfiniteInt(1) == InfiniteInt(0) - max);
+   CHECK(printInfiniteInt(max * max) == "85070591730234615847396907784232501249");
+   CHECK(max * max - max * max == InfiniteInt(0));
+}
+
+TEST_CASE("[InfiniteInt] Comparison handles one inline and one spilled value", "[InfiniteInt inline]") {
+   InfiniteInt big = readInfiniteInt("100000000000000000000");
+   InfiniteInt negativeBig = readInfiniteInt("-100000000000000000000");
+
+   CHECK(InfiniteInt(5) < big);
+   CHECK_FALSE(big < InfiniteInt(5));
+   CHECK(negativeBig < InfiniteInt(-5));
+   CHECK_FALSE(InfiniteInt(-5) < negativeBig);
+   CHECK_FALSE(big == InfiniteInt(5));
+   CHECK(big - big == InfiniteInt(0));
+}
+
+TEST_CASE("[InfiniteInt] Operator int rejects values beyond int held inline or in limbs", "[InfiniteInt inline]") {
+   CHECK_THROWS_AS(static_cast<int>(InfiniteInt(INT_MAX) + InfiniteInt(1)), std::range_error);
+   CHECK_THROWS_AS(static_cast<int>(InfiniteInt(INT_MIN) - InfiniteInt(1)), std::range_error);
+   CHECK_THROWS_AS(static_cast<int>(readInfiniteInt("100000000000000000000")), std::range_error);
+   CHECK(static_cast<int>(readInfiniteInt("100000000000000000000") - readInfiniteInt("99999999999999999999")) == 1);
+}
+// END INLINE VALUE TESTS
+
+// NATIVE CONVERSION TESTS
+TEST_CASE("[InfiniteInt] toInt64 converts every long long, including LLONG_MIN", "[InfiniteInt::toInt64]") {
+   long long value{42};
+
+   CHECK(readInfiniteInt("-9223372036854775808").toInt64(value));
+   CHECK(value == LLONG_MIN);
+   CHECK(readInfiniteInt("9223372036854775807").toInt64(value));
+   CHECK(value == LLONG_MAX);
+   CHECK(InfiniteInt(-17).toInt64(value));
+   CHECK(value == -17);
+}
+
+TEST_CASE("[InfiniteInt] toInt64 reports numbers outside long long and leaves the value alone", "[InfiniteInt::toInt64]") {
+   long long value{42};
+
+   CHECK_FALSE(readInfiniteInt("9223372036854775808").toInt64(value));
+   CHECK_FALSE(readInfiniteInt("-9223372036854775809").toInt64(value));
+   CHECK_FALSE(readInfiniteInt("-18446744073709551616").toInt64(value));
+   CHECK_FALSE(readInfiniteInt("100000000000000000000000000000000000000").toInt64(value));
+   CHECK(value == 42);
+}
+
+TEST_CASE("[InfiniteInt] toUint64 converts [0, ULLONG_MAX] and reports everything else", "[InfiniteInt::toUint64]") {
+   unsigned long long value{42};
+
+   CHECK(readInfiniteInt("18446744073709551615").toUint64(value));
+   CHECK(value == ULLONG_MAX);
+   CHECK(readInfiniteInt("9223372036854775808").toUint64(value));
+   CHECK(value == 9223372036854775808ULL);
+   CHECK(InfiniteInt(0).toUint64(value));
+   CHECK(value == 0);
+
+   value = 42;
+   CHECK_FALSE(readInfiniteInt("18446744073709551616").toUint64(value));
+   CHECK_FALSE(readInfiniteInt("99999999999999999999999999").toUint64(value));
+   CHECK_FALSE(InfiniteInt(-1).toUint64(value));
+   CHECK_FALSE(readInfiniteInt("-9223372036854775808").toUint64(value));
+   CHECK(value == 42);
+}
+
+TEST_CASE("[InfiniteInt] tryConvert checks the range of narrower types", "[InfiniteInt::tryConvert]") {
+   short shortValue{7};
+   unsigned char byteValue{7};
+   unsigned int unsignedValue{7};
+   long long wideValue{7};
+
+   CHECK(InfiniteInt(-32768).tryConvert(shortValue));
+   CHECK(shortValue == -32768);
+   CHECK_FALSE(InfiniteInt(32768).tryConvert(shortValue));
+   CHECK(InfiniteInt(255).tryConvert(byteValue));
+   CHECK(byteValue == 255);
+   CHECK_FALSE(InfiniteInt(256).tryConvert(byteValue));
+   CHECK_FALSE(InfiniteInt(-1).tryConvert(byteValue));
+   CHECK(readInfiniteInt("4294967295").tryConvert(unsignedValue));
+   CHECK(unsignedValue == 4294967295u);
+   CHECK_FALSE(readInfiniteInt("4294967296").tryConvert(unsignedValue));
+   CHECK(readInfiniteInt("-9223372036854775808").tryConvert(wideValue));
+   CHECK(wideValue == LLONG_MIN);
+   CHECK(byteValue == 255);
+   CHECK(shortValue == -32768);
+}
+
+TEST_CASE("[InfiniteInt] Wide integer constructors convert every value exactly", "[InfiniteInt constructors]") {
+   const __int128 int128Max = static_cast<__int128>((static_cast<unsigned __int128>(1) << 127) - 1);
+
+   CHECK(printInfiniteInt(InfiniteInt(LLONG_MAX)) == "9223372036854775807");
+   CHECK(printInfiniteInt(InfiniteInt(LLONG_MIN)) == "-9223372036854775808");
+   CHECK(printInfiniteInt(InfiniteInt(ULLONG_MAX)) == "18446744073709551615");
+   CHECK(printInfiniteInt(InfiniteInt(4000000000u)) == "4000000000");
+   CHECK(printInfiniteInt(InfiniteInt(-5000000000L)) == "-5000000000");
+   CHECK(printInfiniteInt(InfiniteInt(int128Max)) == "170141183460469231731687303715884105727");
+   CHECK(printInfiniteInt(InfiniteInt(-int128Max - 1)) == "-170141183460469231731687303715884105728");
+   CHECK(printInfiniteInt(InfiniteInt(static_cast<__int128>(-12))) == "-12");
+   CHECK(InfiniteInt(LLONG_MIN) == readInfiniteInt("-9223372036854775808"));
+   CHECK(InfiniteInt(ULLONG_MAX) - InfiniteInt(1) == readInfiniteInt("18446744073709551614"));
+   CHECK(InfiniteInt(static_cast<__int128>(LLONG_MAX)) == InfiniteInt(LLONG_MAX));
+}
+
+TEST_CASE("[InfiniteInt] Double constructor truncates toward zero exactly", "[InfiniteInt constructors]") {
+   CHECK(printInfiniteInt(InfiniteInt(9.99)) == "9");
+   CHECK(printInfiniteInt(InfiniteInt(-9.99)) == "-9");
+   CHECK(printInfiniteInt(InfiniteInt(-0.5)) == "0");
+   CHECK(InfiniteInt(-0.5) == InfiniteInt(0));
+   CHECK(printInfiniteInt(InfiniteInt(9223372036854775808.0)) == "9223372036854775808");
+   CHECK(printInfiniteInt(InfiniteInt(-1.5e19)) == "-15000000000000000000");
+   CHECK(printInfiniteInt(InfiniteInt(18446744073709551616.0)) == "18446744073709551616");
+   CHECK(printInfiniteInt(InfiniteInt(1e30)) == "1000000000000000019884624838656");
+
+   std::string largest = printInfiniteInt(InfiniteInt(std::numeric_limits<double>::max()));
+   CHECK(largest.size() == 309);
+   CHECK(largest.substr(297) == "184124858368");
+}
+
+TEST_CASE("[InfiniteInt] Double constructor rejects infinities and NaN", "[InfiniteInt constructors]") {
+   CHECK_THROWS_AS(InfiniteInt(std::numeric_limits<double>::infinity()), std::domain_error);
+   CHECK_THROWS_AS(InfiniteInt(-std::numeric_limits<double>::infinity()), std::domain_error);
+   CHECK_THROWS_AS(InfiniteInt(std::numeric_limits<double>::quiet_NaN()), std::domain_error);
+}
+// END NATIVE CONVERSION TESTS
+
+// MULTIPLICATION ALGORITHM TESTS
+void testFastMultiplyMatchesSchoolbook(const std::string& inputDescription,
+                                       const InfiniteInt& lhs,
+                                       const InfiniteInt& rhs,
+                                       int toom3Threshold,
+                                       int unbalancedToomThreshold)
+{
+   SECTION(inputDescription) {
+      // Setup
+      ThresholdGuard guard;
+
+      // Run
+      InfiniteInt::setKaratsubaThreshold(1000000);
+      InfiniteInt::setNttThreshold(1000000);
+      std::string schoolbook = printInfiniteInt(lhs * rhs);
+      InfiniteInt::setKaratsubaThreshold(4);
+      InfiniteInt::setToom3Threshold(toom3Threshold);
+      InfiniteInt::setUnbalancedToomThreshold(unbalancedToomThreshold);
+      std::string fast = printInfiniteInt(lhs * rhs);
+
+      // Test
+      CHECK(fast == schoolbook);
+   }
+}
+
+TEST_CASE("[InfiniteInt] Karatsuba multiplication matches schoolbook multiplication", "[InfiniteInt::operator*]") {
+   InfiniteInt large = readInfiniteInt(pseudoRandomDigits(900, 1));
+   InfiniteInt otherLarge = readInfiniteInt(pseudoRandomDigits(850, 2));
+   InfiniteInt medium = readInfiniteInt(pseudoRandomDigits(200, 3));
+   InfiniteInt small = readInfiniteInt("-" + pseudoRandomDigits(30, 4));
+
+   testFastMultiplyMatchesSchoolbook("Balanced operands", large, otherLarge, 1000000, 1000000);
+   testFastMultiplyMatchesSchoolbook("Unbalanced operands", medium, large, 1000000, 1000000);
+   testFastMultiplyMatchesSchoolbook("Very unbalanced operands with a negative", large, small, 1000000, 1000000);
+   testFastMultiplyMatchesSchoolbook("Squaring", large, large, 1000000, 1000000);
+}
+
+TEST_CASE("[InfiniteInt] Toom multiplication matches schoolbook multiplication", "[InfiniteInt::operator*]") {
+   InfiniteInt large = readInfiniteInt(pseudoRandomDigits(1200, 5));
+   InfiniteInt otherLarge = readInfiniteInt("-" + pseudoRandomDigits(1150, 6));
+   InfiniteInt twoThirds = readInfiniteInt(pseudoRandomDigits(800, 7));
+   InfiniteInt half = readInfiniteInt(pseudoRandomDigits(600, 8));
+   InfiniteInt nines = readInfiniteInt(std::string(1200, '9'));
+
+   testFastMultiplyMatchesSchoolbook("Toom-3, balanced operands", large, otherLarge, 4, 1000000);
+   testFastMultiplyMatchesSchoolbook("Toom-3, squaring all nines", nines, nines, 4, 1000000);
+   testFastMultiplyMatchesSchoolbook("Toom-2.5, operands 3:2", large, twoThirds, 1000000, 4);
+   testFastMultiplyMatchesSchoolbook("Toom-4.2, operands 2:1", half, otherLarge, 1000000, 4);
+   testFastMultiplyMatchesSchoolbook("Toom-4.2, all nines", nines, readInfiniteInt(std::string(600, '9')), 4, 4);
+   testFastMultiplyMatchesSchoolbook("All algorithms mixed", large, twoThirds * half, 4, 4);
+}
+
+TEST_CASE("[InfiniteInt] NTT multiplication matches schoolbook multiplication", "[InfiniteInt::operator*]") {
+   // Setup
+   ThresholdGuard guard;
+   InfiniteInt large = readInfiniteInt(pseudoRandomDigits(3000, 9));
+   InfiniteInt otherLarge = readInfiniteInt("-" + pseudoRandomDigits(2500, 10));
+   InfiniteInt medium = readInfiniteInt(pseudoRandomDigits(100, 11));
+   InfiniteInt nines = readInfiniteInt(std::string(3000, '9'));
+   InfiniteInt allOnes(1);   // 2^3200 - 1, whose limbs are all at their maximum in binary mode
+   for (int i = 0; i < 100; ++i) {
+      allOnes = allOnes * readInfiniteInt("4294967296");
+   }
+   allOnes = allOnes - InfiniteInt(1);
+
+   const InfiniteInt* operands[][2] = { { &large, &otherLarge }, { &large, &medium },
+                                        { &nines, &nines }, { &allOnes, &allOnes } };
+   for (auto& pair : operands) {
+      // Run
+      InfiniteInt::setKaratsubaThreshold(1000000);
+      InfiniteInt::setNttThreshold(1000000);
+      std::string schoolbook = printInfiniteInt(*pair[0] * *pair[1]);
+      InfiniteInt::setKaratsubaThreshold(4);
+      InfiniteInt::setNttThreshold(4);
+      std::string ntt = printInfiniteInt(*pair[0] * *pair[1]);
+
+      // Test
+      CHECK(ntt == schoolbook);
+   }
+}
+
+TEST_CASE("[InfiniteInt] Karatsuba multiplication carries through runs of nines", "[InfiniteInt::operator*]") {
+   // (10^n - 1)^2 = 99...9800...01 with n - 1 nines and n - 1 zeroes
+   ThresholdGuard guard;
+   InfiniteInt::setKaratsubaThreshold(4);
+   InfiniteInt nines = readInfiniteInt(std::string(500, '9'));
+   std::string square = printInfiniteInt(nines * nines);
+
+   CHECK(square == std::string(499, '9') + "8" + std::string(499, '0') + "1");
+}
+
+TEST_CASE("[InfiniteInt] Schoolbook multiplication carries across many deferred rows", "[InfiniteInt::operator*]") {
+   // Setup (operands of 100 limbs, so carries are normalized several times)
+   ThresholdGuard guard;
+   InfiniteInt::setKaratsubaThreshold(1000000);
+   InfiniteInt::setNttThreshold(1000000);
+   InfiniteInt nines = readInfiniteInt(std::string(900, '9'));
+
+   // Run
+   std::string square = printInfiniteInt(nines * nines);
+   std::string product = printInfiniteInt(nines * readInfiniteInt(std::string(200, '9')));
+
+   // Test
+   CHECK(square == std::string(899, '9') + "8" + std::string(899, '0') + "1");
+   CHECK(product == std::string(199, '9') + "8" + std::string(700, '9') + std::string(199, '0') + "1");
+}
+
+TEST_CASE("[InfiniteInt] Multiplication thresholds reject sizes that cannot be split", "[InfiniteInt::operator*]") {
+   CHECK_THROWS_AS(InfiniteInt::setKaratsubaThreshold(3), std::invalid_argument);
+   CHECK_THROWS_AS(InfiniteInt::setToom3Threshold(3), std::invalid_argument);
+   CHECK_THROWS_AS(InfiniteInt::setUnbalancedToomThreshold(0), std::invalid_argument);
+   CHECK_THROWS_AS(InfiniteInt::setNttThreshold(0), std::invalid_argument);
+}
+// END MULTIPLICATION ALGORITHM TESTS
+
+// COMPOUND ASSIGNMENT TESTS
+TEST_CASE("[InfiniteInt] Operator+= matches operator+ for every sign and size", "[InfiniteInt::operator+=]") {
+   const char* values[] = { "0", "7", "-7", "999999999", "-1000000000", "9223372036854775807",
+                            "-9223372036854775807", "9223372036854775808", "-18446744073709551616",
+                            "999999999999999999999999999999", "-1000000000000000000000000000000" };
+   for (const char* lhsText : values) {
+      for (const char* rhsText : values) {
+         // Setup
+         InfiniteInt lhs = readInfiniteInt(lhsText);
+         InfiniteInt rhs = readInfiniteInt(rhsText);
+         InfiniteInt sum = lhs;
+         InfiniteInt difference = lhs;
+
+         // Run
+         sum += rhs;
+         difference -= rhs;
+
+         // Test
+         INFO(lhsText << " and " << rhsText);
+         CHECK(printInfiniteInt(sum) == printInfiniteInt(lhs + rhs));
+         CHECK(printInfiniteInt(difference) == printInfiniteInt(lhs - rhs));
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Operator+= carries into a new limb and operator-= borrows out of one", "[InfiniteInt::operator+=]") {
+   // Setup
+   InfiniteInt nines = readInfiniteInt(std::string(60, '9'));
+   InfiniteInt power = readInfiniteInt("1" + std::string(60, '0'));
+
+   // Run
+   InfiniteInt carried = nines;
+   carried += InfiniteInt(1);
+   InfiniteInt borrowed = power;
+   borrowed -= InfiniteInt(1);
+   InfiniteInt flipped = InfiniteInt(1);
+   flipped -= power;
+
+   // Test
+   CHECK(carried == power);
+   CHECK(borrowed == nines);
+   CHECK(printInfiniteInt(flipped) == "-" + std::string(60, '9'));
+}
+
+TEST_CASE("[InfiniteInt] Compound assignment works when both sides are the same InfiniteInt", "[InfiniteInt::operator+=]") {
+   // Setup
+   InfiniteInt doubled = readInfiniteInt(std::string(40, '9'));
+   InfiniteInt cancelled = readInfiniteInt("-" + std::string(40, '9'));
+   InfiniteInt squared = readInfiniteInt(std::string(40, '9'));
+
+   // Run
+   doubled += doubled;
+   cancelled -= cancelled;
+   squared *= squared;
+
+   // Test
+   CHECK(printInfiniteInt(doubled) == "1" + std::string(39, '9') + "8");
+   CHECK(cancelled == InfiniteInt(0));
+   CHECK(printInfiniteInt(cancelled) == "0");
+   CHECK(printInfiniteInt(squared) == std::string(39, '9') + "8" + std::string(39, '0') + "1");
+}
+
+TEST_CASE("[InfiniteInt] Operator*= matches operator* and can shrink back inline", "[InfiniteInt::operator*=]") {
+   // Setup
+   InfiniteInt big = readInfiniteInt("123456789012345678901234567890");
+   InfiniteInt product = big;
+   InfiniteInt zeroed = big;
+
+   // Run
+   product *= InfiniteInt(-3);
+   zeroed *= InfiniteInt(0);
+
+   // Test
+   CHECK(printInfiniteInt(product) == "-370370367037037036703703703670");
+   CHECK(product == big * InfiniteInt(-3));
+   CHECK(zeroed == InfiniteInt(0));
+   CHECK(zeroed.numDigits() == 1);
+}
+// END COMPOUND ASSIGNMENT TESTS
+
+// DIVISION TESTS
+// Checks that divmod agrees with / and %, and that the quotient and remainder
+// satisfy q * d + r == n with |r| < |d| and r taking n's sign
+void testDivisionIdentity(const InfiniteInt& dividend, const InfiniteInt& divisor) {
+   // Run
+   InfiniteInt quotient;
+   InfiniteInt remainder;
+   dividend.divmod(divisor, quotient, remainder);
+
+   // Test
+   InfiniteInt zero(0);
+   InfiniteInt remainderMagnitude = remainder < zero ? zero - remainder : remainder;
+   InfiniteInt divisorMagnitude = divisor < zero ? zero - divisor : divisor;
+   INFO(printInfiniteInt(dividend) << " / " << printInfiniteInt(divisor));
+   CHECK(quotient == dividend / divisor);
+   CHECK(remainder == dividend % divisor);
+   CHECK(quotient * divisor + remainder == dividend);
+   CHECK(remainderMagnitude < divisorMagnitude);
+   CHECK((remainder == zero || (remainder < zero) == (dividend < zero)));
+}
+
+TEST_CASE("[InfiniteInt] Division truncates toward zero", "[InfiniteInt::operator/]") {
+   CHECK(printInfiniteInt(InfiniteInt(7) / InfiniteInt(2)) == "3");
+   CHECK(printInfiniteInt(InfiniteInt(-7) / InfiniteInt(2)) == "-3");
+   CHECK(printInfiniteInt(InfiniteInt(7) / InfiniteInt(-2)) == "-3");
+   CHECK(printInfiniteInt(InfiniteInt(-7) / InfiniteInt(-2)) == "3");
+   CHECK(printInfiniteInt(InfiniteInt(7) % InfiniteInt(-2)) == "1");
+   CHECK(printInfiniteInt(InfiniteInt(-7) % InfiniteInt(2)) == "-1");
+   CHECK(printInfiniteInt(InfiniteInt(5) / readInfiniteInt("100000000000000000000")) == "0");
+   CHECK(printInfiniteInt(InfiniteInt(-5) % readInfiniteInt("100000000000000000000")) == "-5");
+}
+
+TEST_CASE("[InfiniteInt] Division of multi-limb numbers", "[InfiniteInt::operator/]") {
+   InfiniteInt big = readInfiniteInt("123456789012345678901234567890");
+   InfiniteInt power = readInfiniteInt("1" + std::string(40, '0')) + InfiniteInt(12345);
+
+   CHECK(printInfiniteInt(big / readInfiniteInt("987654321987")) == "124999998748520313");
+   CHECK(printInfiniteInt(big % readInfiniteInt("987654321987")) == "645722545959");
+   CHECK(printInfiniteInt(power / InfiniteInt(7)) == "1428571428571428571428571428571428573192");
+   CHECK(printInfiniteInt(power % InfiniteInt(-7)) == "1");
+   CHECK(printInfiniteInt(big / big) == "1");
+   CHECK(printInfiniteInt(big % big) == "0");
+}
+
+TEST_CASE("[InfiniteInt] Division satisfies q * d + r == n across sizes and signs", "[InfiniteInt::operator/]") {
+   const int sizes[] = { 1, 9, 10, 18, 19, 27, 40, 81, 200 };
+   unsigned seed = 1;
+   for (int dividendSize : sizes) {
+      for (int divisorSize : sizes) {
+         std::string dividendDigits = pseudoRandomDigits(dividendSize, seed++);
+         std::string divisorDigits = pseudoRandomDigits(divisorSize, seed++);
+         testDivisionIdentity(readInfiniteInt(dividendDigits), readInfiniteInt(divisorDigits));
+         testDivisionIdentity(readInfiniteInt("-" + dividendDigits), readInfiniteInt(divisorDigits));
+         testDivisionIdentity(readInfiniteInt(dividendDigits), readInfiniteInt("-" + divisorDigits));
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Division corrects a quotient limb estimated one too big", "[InfiniteInt::operator/]") {
+   /* In limb base B, (B/2 - 1, B/2, 0, 0) / (B/2, 0, 1) estimates the quotient
+      limb as B - 1 but it is really B - 2, which needs the add-back step. Both
+      limb bases are checked, one of which is the base in use. */
+   const char* bases[] = { "1000000000", "4294967296" };
+   for (const char* baseText : bases) {
+      // Setup
+      InfiniteInt base = readInfiniteInt(baseText);
+      InfiniteInt half = base / InfiniteInt(2);
+      InfiniteInt dividend = ((half - InfiniteInt(1)) * base + half) * base * base;
+      InfiniteInt divisor = half * base * base + InfiniteInt(1);
+
+      // Run
+      InfiniteInt quotient;
+      InfiniteInt remainder;
+      dividend.divmod(divisor, quotient, remainder);
+
+      // Test
+      CHECK(quotient == base - InfiniteInt(2));
+      CHECK(remainder == half * base * base - base + InfiniteInt(2));
+   }
+}
+
+TEST_CASE("[InfiniteInt] Division handles divisors and results shared with the dividend", "[InfiniteInt::operator/]") {
+   // Setup
+   InfiniteInt dividend = readInfiniteInt("-" + std::string(50, '9'));
+   InfiniteInt divisor = readInfiniteInt("1" + std::string(20, '0'));
+   InfiniteInt quotient = dividend;
+   InfiniteInt remainder = divisor;
+   InfiniteInt selfQuotient = dividend;
+   InfiniteInt selfRemainder = dividend;
+
+   // Run
+   quotient.divmod(remainder, quotient, remainder);
+   selfQuotient /= selfQuotient;
+   selfRemainder %= selfRemainder;
+
+   // Test
+   CHECK(printInfiniteInt(quotient) == "-" + std::string(30, '9'));
+   CHECK(printInfiniteInt(remainder) == "-" + std::string(20, '9'));
+   CHECK(printInfiniteInt(selfQuotient) == "1");
+   CHECK(printInfiniteInt(selfRemainder) == "0");
+}
+
+TEST_CASE("[InfiniteInt] Division by zero throws", "[InfiniteInt::operator/]") {
+   InfiniteInt quotient;
+   InfiniteInt remainder;
+
+   CHECK_THROWS_AS(InfiniteInt(1) / InfiniteInt(0), std::domain_error);
+   CHECK_THROWS_AS(readInfiniteInt("100000000000000000000") % InfiniteInt(0), std::domain_error);
+   CHECK_THROWS_AS(InfiniteInt(1).divmod(InfiniteInt(0), quotient, remainder), std::domain_error);
+}
+// END DIVISION TESTS
+
+// DIVISION ALGORITHM TESTS
+// Checks that the given thresholds give the same quotient and remainder as long division
+void testFastDivideMatchesLongDivision(const InfiniteInt& dividend, const InfiniteInt& divisor,
+                                       int burnikelZieglerThreshold, int newtonThreshold) {
+   // Setup
+   ThresholdGuard guard;
+   InfiniteInt longQuotient;
+   InfiniteInt longRemainder;
+   InfiniteInt fastQuotient;
+   InfiniteInt fastRemainder;
+
+   // Run
+   InfiniteInt::setBurnikelZieglerThreshold(1000000);
+   dividend.divmod(divisor, longQuotient, longRemainder);
+   InfiniteInt::setBurnikelZieglerThreshold(burnikelZieglerThreshold);
+   InfiniteInt::setNewtonDivisionThreshold(newtonThreshold);
+   dividend.divmod(divisor, fastQuotient, fastRemainder);
+
+   // Test
+   INFO(dividend.numDigits() << "-digit / " << divisor.numDigits() << "-digit, thresholds "
+        << burnikelZieglerThreshold << " and " << newtonThreshold);
+   CHECK(fastQuotient == longQuotient);
+   CHECK(fastRemainder == longRemainder);
+}
+
+TEST_CASE("[InfiniteInt] Burnikel-Ziegler division matches long division", "[InfiniteInt::operator/]") {
+   const int divisorSizes[] = { 40, 100, 333, 700 };
+   unsigned seed = 100;
+   for (int divisorSize : divisorSizes) {
+      InfiniteInt divisor = readInfiniteInt(pseudoRandomDigits(divisorSize, seed++));
+      for (int dividendSize : { divisorSize + 60, 2 * divisorSize, 5 * divisorSize + 7 }) {
+         InfiniteInt dividend = readInfiniteInt(pseudoRandomDigits(dividendSize, seed++));
+         testFastDivideMatchesLongDivision(dividend, divisor, 2, 1000000);
+         testFastDivideMatchesLongDivision(dividend, divisor, 5, 1000000);
+         testFastDivideMatchesLongDivision(InfiniteInt(0) - dividend, divisor, 3, 1000000);
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Newton division matches long division", "[InfiniteInt::operator/]") {
+   const int divisorSizes[] = { 40, 100, 333, 700 };
+   unsigned seed = 200;
+   for (int divisorSize : divisorSizes) {
+      InfiniteInt divisor = readInfiniteInt(pseudoRandomDigits(divisorSize, seed++));
+      for (int dividendSize : { divisorSize + 60, 2 * divisorSize, 5 * divisorSize + 7 }) {
+         InfiniteInt dividend = readInfiniteInt(pseudoRandomDigits(dividendSize, seed++));
+         testFastDivideMatchesLongDivision(dividend, divisor, 2, 2);
+         testFastDivideMatchesLongDivision(dividend, divisor, 4, 3);
+         testFastDivideMatchesLongDivision(dividend, InfiniteInt(0) - divisor, 3, 5);
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Fast division handles quotients that need correcting", "[InfiniteInt::operator/]") {
+   // All-nines and power-of-ten operands make every estimated limb land on a boundary
+   InfiniteInt nines = readInfiniteInt(std::string(500, '9'));
+   InfiniteInt power = readInfiniteInt("1" + std::string(300, '0'));
+   InfiniteInt almostPower = power - InfiniteInt(1);
+   InfiniteInt product = nines * almostPower;
+
+   testFastDivideMatchesLongDivision(nines, almostPower, 2, 1000000);
+   testFastDivideMatchesLongDivision(nines, almostPower, 2, 2);
+   testFastDivideMatchesLongDivision(product, almostPower, 3, 1000000);
+   testFastDivideMatchesLongDivision(product, almostPower, 3, 3);
+   testFastDivideMatchesLongDivision(product - InfiniteInt(1), power + InfiniteInt(1), 4, 1000000);
+   testFastDivideMatchesLongDivision(product - InfiniteInt(1), power + InfiniteInt(1), 4, 4);
+   CHECK(product / almostPower == nines);
+}
+
+TEST_CASE("[InfiniteInt] Division thresholds reject sizes that cannot be split", "[InfiniteInt::operator/]") {
+   CHECK_THROWS_AS(InfiniteInt::setBurnikelZieglerThreshold(1), std::invalid_argument);
+   CHECK_THROWS_AS(InfiniteInt::setNewtonDivisionThreshold(1), std::invalid_argument);
+}
+// END DIVISION ALGORITHM TESTS
+
+// WORD OPERAND TESTS
+TEST_CASE("[InfiniteInt] Word operands give the same results as InfiniteInt operands", "[InfiniteInt::operator*]") {
+   const char* values[] = { "0", "1", "-7", "999999999", "-4294967296", "9223372036854775807",
+                            "-9223372036854775808", "123456789012345678901234567890",
+                            "-1000000000000000000000000000000000000001" };
+   const long long words[] = { 1, -1, 2, -3, 10, 1000000000, -999999999, INT_MAX, INT_MIN,
+                               4294967295LL, -4294967296LL, 10000000000000LL, LLONG_MAX, LLONG_MIN };
+   for (const char* text : values) {
+      for (long long word : words) {
+         // Setup
+         InfiniteInt value = readInfiniteInt(text);
+         InfiniteInt wordValue = readInfiniteInt(std::to_string(word));
+         InfiniteInt scaled = value;
+         InfiniteInt divided = value;
+         InfiniteInt reduced = value;
+
+         // Run
+         scaled *= word;
+         divided /= word;
+         reduced %= word;
+
+         // Test
+         INFO(text << " and " << word);
+         CHECK(printInfiniteInt(value * word) == printInfiniteInt(value * wordValue));
+         CHECK(printInfiniteInt(value / word) == printInfiniteInt(value / wordValue));
+         CHECK(printInfiniteInt(value % word) == printInfiniteInt(value % wordValue));
+         CHECK(scaled == value * wordValue);
+         CHECK(divided == value / wordValue);
+         CHECK(reduced == value % wordValue);
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Int operands carry and borrow across limbs", "[InfiniteInt::operator*]") {
+   InfiniteInt nines = readInfiniteInt(std::string(50, '9'));
+
+   CHECK(printInfiniteInt(nines * 10) == std::string(50, '9') + "0");
+   CHECK(printInfiniteInt(nines * -2147483647) == "-2147483646" + std::string(40, '9') + "7852516353");
+   CHECK(printInfiniteInt(readInfiniteInt("1" + std::string(50, '0')) / 7) ==
+         "14285714285714285714285714285714285714285714285714");
+   CHECK(printInfiniteInt(readInfiniteInt("-1" + std::string(50, '0')) % 7) == "-2");
+   CHECK(printInfiniteInt(nines / -1) == "-" + std::string(50, '9'));
+   CHECK(printInfiniteInt(nines * 0) == "0");
+   CHECK(printInfiniteInt(nines / 1000000000 * 1000000000 + nines % 1000000000) == std::string(50, '9'));
+}
+
+TEST_CASE("[InfiniteInt] Word division by zero throws", "[InfiniteInt::operator/]") {
+   InfiniteInt big = readInfiniteInt("100000000000000000000");
+
+   CHECK_THROWS_AS(big / 0, std::domain_error);
+   CHECK_THROWS_AS(big % 0LL, std::domain_error);
+   CHECK_THROWS_AS(InfiniteInt(5) /= 0, std::domain_error);
+   CHECK_THROWS_AS(InfiniteInt(5) %= 0LL, std::domain_error);
+}
+// END WORD OPERAND TESTS
+
+// SQUARING TESTS
+// Checks that squaring with the given thresholds matches multiplying by a copy with schoolbook
+void testSquareMatchesSchoolbook(const InfiniteInt& value, int karatsubaThreshold,
+                                 int toom3Threshold, int nttThreshold) {
+   // Setup
+   ThresholdGuard guard;
+   InfiniteInt copy = value;
+
+   // Run
+   InfiniteInt::setKaratsubaThreshold(1000000);
+   InfiniteInt::setNttThreshold(1000000);
+   std::string schoolbook = printInfiniteInt(value * copy);
+   InfiniteInt::setKaratsubaThreshold(karatsubaThreshold);
+   InfiniteInt::setToom3Threshold(toom3Threshold);
+   InfiniteInt::setNttThreshold(nttThreshold);
+   std::string squared = printInfiniteInt(value.square());
+   std::string selfProduct = printInfiniteInt(value * value);
+
+   // Test
+   INFO(value.numDigits() << " digits, thresholds " << karatsubaThreshold << ", "
+        << toom3Threshold << " and " << nttThreshold);
+   CHECK(squared == schoolbook);
+   CHECK(selfProduct == schoolbook);
+}
+
+TEST_CASE("[InfiniteInt] Squaring matches multiplying by a copy", "[InfiniteInt::square]") {
+   const int sizes[] = { 1, 9, 10, 19, 20, 100, 171, 600, 2000 };
+   unsigned seed = 300;
+   for (int size : sizes) {
+      InfiniteInt value = readInfiniteInt(pseudoRandomDigits(size, seed++));
+      testSquareMatchesSchoolbook(value, 1000000, 1000000, 1000000);   // schoolbook
+      testSquareMatchesSchoolbook(value, 4, 1000000, 1000000);         // Karatsuba
+      testSquareMatchesSchoolbook(value, 4, 4, 1000000);               // Toom-3
+      testSquareMatchesSchoolbook(value, 4, 1000000, 1);               // NTT
+      testSquareMatchesSchoolbook(InfiniteInt(0) - value, 5, 9, 1000000);
+   }
+}
+
+TEST_CASE("[InfiniteInt] Squaring carries through runs of nines", "[InfiniteInt::square]") {
+   ThresholdGuard guard;
+   InfiniteInt nines = readInfiniteInt("-" + std::string(700, '9'));
+   std::string expected = std::string(699, '9') + "8" + std::string(699, '0') + "1";
+
+   CHECK(printInfiniteInt(nines.square()) == expected);
+   InfiniteInt::setKaratsubaThreshold(1000000);
+   CHECK(printInfiniteInt(nines.square()) == expected);
+}
+
+TEST_CASE("[InfiniteInt] Squaring spills inline values into limbs", "[InfiniteInt::square]") {
+   InfiniteInt value = readInfiniteInt("-3037000500");
+   InfiniteInt big = readInfiniteInt("9223372036854775807");
+
+   CHECK(printInfiniteInt(value.square()) == "9223372037000250000");
+   CHECK(printInfiniteInt(InfiniteInt(-46341).square()) == "2147488281");
+   CHECK(printInfiniteInt(big.square()) == "85070591730234615847396907784232501249");
+   big *= big;
+   CHECK(printInfiniteInt(big) == "85070591730234615847396907784232501249");
+}
+// END SQUARING TESTS
+
+// POWER TESTS
+TEST_CASE("[InfiniteInt] Powers match repeated multiplication", "[InfiniteInt::pow]") {
+   const char* const bases[] = { "3", "-7", "1000000000", "4294967296", "-123456789012345678901234567",
+                                 "98765432109876543210987654321098765432109876543210" };
+   for (const char* baseText : bases) {
+      InfiniteInt base = readInfiniteInt(baseText);
+      InfiniteInt expected = readInfiniteInt("1");
+      for (unsigned exponent = 0; exponent <= 70; ++exponent) {
+         INFO(baseText << "^" << exponent);
+         CHECK(printInfiniteInt(base.pow(exponent)) == printInfiniteInt(expected));
+         expected *= base;
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Powers of zero, one and minus one", "[InfiniteInt::pow]") {
+   CHECK(printInfiniteInt(InfiniteInt(0).pow(0)) == "1");
+   CHECK(printInfiniteInt(InfiniteInt(0).pow(5)) == "0");
+   CHECK(printInfiniteInt(InfiniteInt(1).pow(4000000000u)) == "1");
+   CHECK(printInfiniteInt(InfiniteInt(-1).pow(4000000001u)) == "-1");
+   CHECK(printInfiniteInt(InfiniteInt(-1).pow(4000000000u)) == "1");
+}
+
+TEST_CASE("[InfiniteInt] Large powers have the right digits", "[InfiniteInt::pow]") {
+   ThresholdGuard guard;
+   InfiniteInt::setKaratsubaThreshold(4);
+   InfiniteInt::setToom3Threshold(9);
+
+   std::string power = printInfiniteInt(InfiniteInt(10).pow(5000));
+   CHECK(power == "1" + std::string(5000, '0'));
+   power = printInfiniteInt(InfiniteInt(-2).pow(3001));
+   CHECK(power.size() == 905);
+   CHECK(power.substr(0, 6) == "-24604");
+   CHECK(power.substr(power.size() - 4) == "8752");
+   CHECK(printInfiniteInt(readInfiniteInt("999999999999").pow(3)) ==
+         "999999999997000000000002999999999999");
+}
+
+TEST_CASE("[InfiniteInt] Powers that cannot be counted in limbs throw", "[InfiniteInt::pow]") {
+   InfiniteInt big = readInfiniteInt("123456789012345678901234567890");
+   CHECK_THROWS_AS(big.pow(4000000000u), std::length_error);
+}
+// END POWER TESTS
+
+// GCD TESTS
+// Finds the gcd with plain Euclidean steps, one remainder at a time
+InfiniteInt euclidGcd(InfiniteInt a, InfiniteInt b) {
+   while (b != InfiniteInt(0)) {
+      InfiniteInt remainder = a % b;
+      a = b;
+      b = remainder;
+   }
+   return a < InfiniteInt(0) ? InfiniteInt(0) - a : a;
+}
+
+// Checks gcd(), lcm() and extendedGcd() against Euclid's algorithm and the Bezout identity
+void testGcdMatchesEuclid(const InfiniteInt& a, const InfiniteInt& b) {
+   // Setup
+   InfiniteInt expected = euclidGcd(a, b);
+   InfiniteInt x;
+   InfiniteInt y;
+
+   // Run
+   InfiniteInt gcd = a.gcd(b);
+   InfiniteInt extended = a.extendedGcd(b, x, y);
+
+   // Test
+   INFO(a.numDigits() << "-digit and " << b.numDigits() << "-digit operands");
+   CHECK(gcd == expected);
+   CHECK(extended == expected);
+   CHECK(a * x + b * y == expected);
+   if (b != InfiniteInt(0)) {
+      InfiniteInt twiceX = x * 2LL * expected;
+      CHECK(!(b * b < twiceX * twiceX));
+   }
+   if (expected != InfiniteInt(0)) {
+      InfiniteInt lcm = a / expected * b;
+      CHECK(a.lcm(b) == (lcm < InfiniteInt(0) ? InfiniteInt(0) - lcm : lcm));
+   }
+}
+
+TEST_CASE("[InfiniteInt] Gcds of small numbers", "[InfiniteInt::gcd]") {
+   CHECK(printInfiniteInt(InfiniteInt(48).gcd(InfiniteInt(-18))) == "6");
+   CHECK(printInfiniteInt(InfiniteInt(-17).gcd(InfiniteInt(5))) == "1");
+   CHECK(printInfiniteInt(InfiniteInt(0).gcd(InfiniteInt(-5))) == "5");
+   CHECK(printInfiniteInt(InfiniteInt(0).gcd(InfiniteInt(0))) == "0");
+   CHECK(printInfiniteInt(readInfiniteInt("9223372036854775807").gcd(readInfiniteInt("-9223372036854775807"))) ==
+         "9223372036854775807");
+   CHECK(printInfiniteInt(InfiniteInt(4).lcm(InfiniteInt(-6))) == "12");
+   CHECK(printInfiniteInt(InfiniteInt(0).lcm(InfiniteInt(6))) == "0");
+   for (int a = -30; a <= 30; a += 7) {
+      for (int b = -24; b <= 24; b += 4) {
+         testGcdMatchesEuclid(InfiniteInt(a), InfiniteInt(b));
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Gcds of numbers with known common factors", "[InfiniteInt::gcd]") {
+   InfiniteInt a = InfiniteInt(2).pow(300) * InfiniteInt(3).pow(100);
+   InfiniteInt b = InfiniteInt(2).pow(200) * InfiniteInt(3).pow(150) * InfiniteInt(-7);
+   CHECK(a.gcd(b) == InfiniteInt(2).pow(200) * InfiniteInt(3).pow(100));
+   CHECK(a.lcm(b) == InfiniteInt(2).pow(300) * InfiniteInt(3).pow(150) * InfiniteInt(7));
+
+   // Consecutive Fibonacci numbers take the most Euclidean steps for their size
+   InfiniteInt previous(0);
+   InfiniteInt current(1);
+   for (int i = 0; i < 3000; ++i) {
+      InfiniteInt next = previous + current;
+      previous = current;
+      current = next;
+   }
+   testGcdMatchesEuclid(current, previous);
+   CHECK(printInfiniteInt(current.gcd(previous)) == "1");
+}
+
+TEST_CASE("[InfiniteInt] Gcds match Euclid's algorithm across sizes and signs", "[InfiniteInt::gcd]") {
+   const int sizes[] = { 5, 18, 19, 40, 100, 333, 1000 };
+   unsigned seed = 300;
+   for (int lhsSize : sizes) {
+      for (int rhsSize : sizes) {
+         InfiniteInt a = readInfiniteInt(pseudoRandomDigits(lhsSize, seed++));
+         InfiniteInt b = readInfiniteInt(pseudoRandomDigits(rhsSize, seed++));
+         InfiniteInt factor = readInfiniteInt(pseudoRandomDigits(1 + lhsSize / 3, seed++));
+         testGcdMatchesEuclid(a, b);
+         testGcdMatchesEuclid(InfiniteInt(0) - a * factor, b * factor);
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Half-GCD matches Euclid's algorithm", "[InfiniteInt::gcd]") {
+   ThresholdGuard guard;
+   unsigned seed = 400;
+   for (int threshold : { 4, 7, 30 }) {
+      InfiniteInt::setHalfGcdThreshold(threshold);
+      for (int size : { 60, 400, 2500 }) {
+         InfiniteInt a = readInfiniteInt(pseudoRandomDigits(size, seed++));
+         InfiniteInt b = readInfiniteInt(pseudoRandomDigits(size, seed++));
+         InfiniteInt factor = readInfiniteInt(pseudoRandomDigits(size / 2, seed++));
+         INFO("threshold " << threshold);
+         testGcdMatchesEuclid(a, b);
+         testGcdMatchesEuclid(a * factor, InfiniteInt(0) - b * factor);
+         testGcdMatchesEuclid(a * factor, factor);
+      }
+   }
+}
+
+TEST_CASE("[InfiniteInt] Extended gcd handles zero operands and shared coefficients", "[InfiniteInt::extendedGcd]") {
+   InfiniteInt x(99);
+   InfiniteInt y(99);
+   CHECK(printInfiniteInt(InfiniteInt(0).extendedGcd(InfiniteInt(0), x, y)) == "0");
+   CHECK(x == InfiniteInt(0));
+   CHECK(y == InfiniteInt(0));
+   CHECK(printInfiniteInt(InfiniteInt(-12).extendedGcd(InfiniteInt(0), x, y)) == "12");
+   CHECK(x == InfiniteInt(-1));
+   CHECK(y == InfiniteInt(0));
+
+   // The coefficients may be the operands themselves
+   InfiniteInt a = readInfiniteInt("1234567890123456789012345678901234567890");
+   InfiniteInt b = readInfiniteInt("-987654321098765432109876543210");
+   InfiniteInt originalA = a;
+   InfiniteInt originalB = b;
+   InfiniteInt gcd = a.extendedGcd(b, a, b);
+   CHECK(printInfiniteInt(gcd) == "90");
+   CHECK(originalA * a + originalB * b == gcd);
+}
+
+TEST_CASE("[InfiniteInt] Half-GCD threshold rejects sizes that cannot be split", "[InfiniteInt::gcd]") {
+   CHECK_THROWS_AS(InfiniteInt::setHalfGcdThreshold(3), std::invalid_argument);
+}
+// END GCD TESTS
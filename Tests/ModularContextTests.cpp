@@ -0,0 +1,153 @@
+/**
+ * @file ModularContextTests.cpp
+ * @brief Defines catch2 unit tests for ModularContext
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+
+#include "catch.hpp"             // catch2 required header
+#include "../ModularContext.h"   // class being tested
+#include "TestHelpers.h"         // readInfiniteInt, printInfiniteInt and pseudoRandomDigits
+#include <string>                // std::string
+
+// CONSTRUCTOR TESTS
+TEST_CASE("ModularContext picks Montgomery form for moduli coprime to the limb base", "[ModularContext]") {
+   CHECK(ModularContext(readInfiniteInt("170141183460469231731687303715884105727")).usesMontgomery());
+   CHECK(ModularContext(InfiniteInt(3)).usesMontgomery());
+   CHECK_FALSE(ModularContext(readInfiniteInt("340282366920938463463374607431768211456")).usesMontgomery());
+#ifndef INFINITEINT_BINARY
+   CHECK_FALSE(ModularContext(readInfiniteInt("10000000000000000000000000000000000000005")).usesMontgomery());
+#endif
+}
+
+TEST_CASE("ModularContext uses Barrett reduction for moduli at the Montgomery threshold", "[ModularContext]") {
+   // Setup
+   const int oldThreshold = ModularContext::montgomeryThreshold();
+   InfiniteInt prime = readInfiniteInt("170141183460469231731687303715884105727");
+
+   // Run
+   ModularContext::setMontgomeryThreshold(1);
+   ModularContext barrett(prime);
+   ModularContext::setMontgomeryThreshold(oldThreshold);
+   ModularContext montgomery(prime);
+
+   // Test
+   CHECK_FALSE(barrett.usesMontgomery());
+   CHECK(montgomery.usesMontgomery());
+   for (int base = -5; base <= 5; ++base) {
+      InfiniteInt exponent = prime - InfiniteInt(base + 10);
+      CHECK(printInfiniteInt(barrett.pow(InfiniteInt(base), exponent)) ==
+            printInfiniteInt(montgomery.pow(InfiniteInt(base), exponent)));
+   }
+   CHECK_THROWS_AS(ModularContext::setMontgomeryThreshold(0), std::invalid_argument);
+   CHECK(ModularContext::montgomeryThreshold() == oldThreshold);
+}
+
+TEST_CASE("ModularContext rejects moduli that are not positive", "[ModularContext]") {
+   CHECK_THROWS_AS(ModularContext(InfiniteInt(0)), std::domain_error);
+   CHECK_THROWS_AS(ModularContext(InfiniteInt(-7)), std::domain_error);
+}
+// END CONSTRUCTOR TESTS
+
+// POW TESTS
+TEST_CASE("ModularContext::pow matches known results", "[ModularContext]") {
+   // Mersenne prime modulus (Montgomery in both limb bases)
+   InfiniteInt prime = readInfiniteInt("170141183460469231731687303715884105727");
+   ModularContext primeContext(prime);
+   CHECK(printInfiniteInt(primeContext.pow(InfiniteInt(3), prime - InfiniteInt(2))) ==
+         "113427455640312821154458202477256070485");
+   CHECK(printInfiniteInt(primeContext.pow(InfiniteInt(3), prime - InfiniteInt(1))) == "1");
+
+   // Power of two modulus (Barrett in both limb bases)
+   ModularContext twoContext(readInfiniteInt("340282366920938463463374607431768211456"));
+   CHECK(printInfiniteInt(twoContext.pow(readInfiniteInt("12345678901234567891"), readInfiniteInt("98765432109876543210"))) ==
+         "279151771534079533424151155980184381321");
+
+   // Modulus ending in 5, and a negative base
+   ModularContext fiveContext(readInfiniteInt("10000000000000000000000000000000000000005"));
+   CHECK(printInfiniteInt(fiveContext.pow(InfiniteInt(-7), readInfiniteInt("1000000000000000000000000000001"))) ==
+         "5805103061004699609255965901266032083323");
+   ModularContext tenContext(readInfiniteInt("1000000000000000000000000000000"));
+   CHECK(printInfiniteInt(tenContext.pow(readInfiniteInt("-123456789123456789"), readInfiniteInt("10000000000000000000000003"))) ==
+         "231900059652045519638139102931");
+
+   // Fermat witness for a composite modulus
+   CHECK(printInfiniteInt(powMod(InfiniteInt(2), readInfiniteInt("998244368971909710889394238"),
+                             readInfiniteInt("998244368971909710889394239"))) ==
+         "100592069140320206314355281");
+}
+
+TEST_CASE("ModularContext::pow matches pow() followed by a remainder", "[ModularContext]") {
+   const char* const moduli[] = { "2", "97", "1000000007", "4294967296", "1000000000000000000000",
+                                  "123456789012345678901234567890123456789",
+                                  "98765432109876543210987654321098765432109876543210987654321" };
+   const char* const bases[] = { "0", "1", "-2", "987654321987654321", "-55555555555555555555555555555" };
+   for (const char* modulusText : moduli) {
+      InfiniteInt modulus = readInfiniteInt(modulusText);
+      ModularContext context(modulus);
+      for (const char* baseText : bases) {
+         InfiniteInt base = readInfiniteInt(baseText);
+         for (unsigned exponent = 0; exponent < 80; exponent += 7) {
+            InfiniteInt expected = base.pow(exponent) % modulus;
+            if (expected < InfiniteInt(0)) {
+               expected += modulus;
+            }
+            INFO(baseText << "^" << exponent << " mod " << modulusText);
+            CHECK(printInfiniteInt(context.pow(base, InfiniteInt(static_cast<int>(exponent)))) ==
+                  printInfiniteInt(expected));
+         }
+      }
+   }
+}
+
+// Builds a pseudo-random number with the given # of digits, led by a 9 and ending in lastDigit
+static InfiniteInt pseudoRandomNumber(int numDigits, unsigned seed, char lastDigit) {
+   std::string digits = pseudoRandomDigits(numDigits, seed);
+   digits[0] = '9';
+   digits.back() = lastDigit;
+   return readInfiniteInt(digits);
+}
+
+TEST_CASE("ModularContext::pow agrees between Montgomery and Barrett on long operands", "[ModularContext]") {
+   const int oldThreshold = ModularContext::montgomeryThreshold();
+   InfiniteInt modulus = pseudoRandomNumber(400, 11, '7');
+   InfiniteInt base = pseudoRandomNumber(450, 12, '3');
+   InfiniteInt exponent = pseudoRandomNumber(300, 13, '1');
+
+   ModularContext::setMontgomeryThreshold(1);
+   ModularContext barrett(modulus);
+   ModularContext::setMontgomeryThreshold(oldThreshold);
+   ModularContext montgomery(modulus);
+
+   CHECK(montgomery.usesMontgomery());
+   CHECK(printInfiniteInt(montgomery.pow(base, exponent)) == printInfiniteInt(barrett.pow(base, exponent)));
+   CHECK(printInfiniteInt(montgomery.pow(base, InfiniteInt(300))) == printInfiniteInt(base.pow(300) % modulus));
+   CHECK(printInfiniteInt(barrett.pow(base, InfiniteInt(300))) == printInfiniteInt(base.pow(300) % modulus));
+}
+
+TEST_CASE("ModularContext::pow carries columns full of the largest limbs", "[ModularContext]") {
+   // Every limb of 10^k - 1 is the largest limb, so each deferred row adds the most it can
+   for (int k : { 180, 400 }) {
+      INFO("k = " << k);
+      ModularContext context(InfiniteInt(10).pow(k) - InfiniteInt(1));
+      InfiniteInt minusOne = InfiniteInt(10).pow(k) - InfiniteInt(2);
+      InfiniteInt minusTwo = minusOne - InfiniteInt(1);
+
+      CHECK(context.usesMontgomery());
+      CHECK(printInfiniteInt(context.pow(minusOne, InfiniteInt(3))) == printInfiniteInt(minusOne));
+      CHECK(printInfiniteInt(context.pow(minusTwo, InfiniteInt(2))) == "4");
+   }
+}
+
+TEST_CASE("ModularContext::pow handles trivial moduli and exponents", "[ModularContext]") {
+   ModularContext one(InfiniteInt(1));
+   CHECK(printInfiniteInt(one.pow(InfiniteInt(5), InfiniteInt(0))) == "0");
+   CHECK(printInfiniteInt(one.pow(InfiniteInt(5), InfiniteInt(9))) == "0");
+
+   ModularContext seven(InfiniteInt(7));
+   CHECK(printInfiniteInt(seven.pow(InfiniteInt(0), InfiniteInt(0))) == "1");
+   CHECK(printInfiniteInt(seven.pow(InfiniteInt(14), InfiniteInt(3))) == "0");
+   CHECK_THROWS_AS(seven.pow(InfiniteInt(2), InfiniteInt(-1)), std::domain_error);
+   CHECK_THROWS_AS(powMod(InfiniteInt(2), InfiniteInt(3), InfiniteInt(0)), std::domain_error);
+}
+// END POW TESTS
@@ -0,0 +1,233 @@
+/**
+ * @file NodePoolTests.cpp
+ * @brief Defines catch2 unit tests for NodePool
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+
+#include "catch.hpp"       // catch2 required header
+#include "../NodePool.h"   // class being tested
+#include <atomic>          // size of the allocation to fail, read by every thread
+#include <cstdint>         // std::uintptr_t for alignment checks
+#include <cstdlib>         // std::malloc and std::free
+#include <new>             // std::bad_alloc from a failed slab
+#include <thread>          // releasing blocks from other threads
+#include <vector>          // blocks handed between threads
+
+// Allocations of exactly this many bytes fail, so a test can make one slab size fail
+// (a real out-of-memory request would abort under valgrind and the sanitizers)
+static std::atomic<std::size_t> failingAllocationSize{0};
+
+void* operator new(std::size_t size) {
+   void* memory = size == failingAllocationSize.load() ? nullptr : std::malloc(size == 0 ? 1 : size);
+   if (memory == nullptr) {
+      throw std::bad_alloc();
+   }
+   return memory;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+   return size == failingAllocationSize.load() ? nullptr : std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* memory) noexcept {
+   std::free(memory);
+}
+
+// CONSTRUCTOR TESTS
+TEST_CASE("NodePool constructor creates a pool with no slabs", "[NodePool]") {
+   // Run
+   NodePool pool(24, 4);
+   NodePool::Stats stats = pool.stats();
+
+   // Test
+   CHECK(stats.slabs == 0);
+   CHECK(stats.liveNodes == 0);
+   CHECK(stats.freeNodes == 0);
+   CHECK(stats.hits == 0);
+   CHECK(stats.misses == 0);
+   CHECK(pool.blockSize() >= 24);
+   CHECK(pool.blockSize() % alignof(std::max_align_t) == 0);
+}
+
+TEST_CASE("NodePool constructor rejects empty blocks and slabs", "[NodePool]") {
+   CHECK_THROWS_AS(NodePool(0, 4), std::invalid_argument);
+   CHECK_THROWS_AS(NodePool(24, 0), std::invalid_argument);
+}
+// END CONSTRUCTOR TESTS
+
+// ALLOCATE/RELEASE TESTS
+TEST_CASE("NodePool::allocate refills one slab at a time", "[NodePool]") {
+   // Setup
+   NodePool pool(24, 4);
+   void* blocks[5];
+
+   // Run
+   for (int i = 0; i < 5; ++i) {
+      blocks[i] = pool.allocate();
+   }
+   NodePool::Stats stats = pool.stats();
+
+   // Test
+   CHECK(stats.slabs == 2);
+   CHECK(stats.liveNodes == 5);
+   CHECK(stats.misses == 5);
+   CHECK(stats.hits == 0);
+   for (int i = 0; i < 5; ++i) {
+      CHECK(reinterpret_cast<std::uintptr_t>(blocks[i]) % alignof(std::max_align_t) == 0);
+      for (int j = 0; j < i; ++j) {
+         CHECK(blocks[i] != blocks[j]);
+      }
+   }
+
+   // Cleanup
+   for (int i = 0; i < 5; ++i) {
+      pool.release(blocks[i]);
+   }
+}
+
+TEST_CASE("NodePool::allocate recycles the most recently released block", "[NodePool]") {
+   // Setup
+   NodePool pool(24, 4);
+   void* first = pool.allocate();
+   void* second = pool.allocate();
+
+   // Run
+   pool.release(first);
+   void* recycled = pool.allocate();
+   NodePool::Stats stats = pool.stats();
+
+   // Test
+   CHECK(recycled == first);
+   CHECK(stats.slabs == 1);
+   CHECK(stats.liveNodes == 2);
+   CHECK(stats.freeNodes == 0);
+   CHECK(stats.hits == 1);
+   CHECK(stats.misses == 2);
+
+   // Cleanup
+   pool.release(recycled);
+   pool.release(second);
+   CHECK(pool.stats().freeNodes == 2);
+   CHECK(pool.stats().liveNodes == 0);
+}
+
+TEST_CASE("NodePool::orphan defers deleting the pool until its last block is released", "[NodePool]") {
+   // Setup
+   NodePool* pool = new NodePool(24, 4);
+   void* block = pool->allocate();
+
+   // Run
+   pool->orphan();
+   REQUIRE(pool->stats().liveNodes == 1);
+
+   // Test (the pool deletes itself here; a leak or double free would be caught by valgrind)
+   pool->release(block);
+}
+
+TEST_CASE("NodePool::allocate leaves the pool unchanged when a slab cannot be allocated", "[NodePool]") {
+   // Setup: a slab size no other allocation in the tests uses
+   const int kBlocksPerSlab = 333;
+   NodePool* pool = new NodePool(1000, kBlocksPerSlab);
+   failingAllocationSize = pool->blockSize() * kBlocksPerSlab;
+
+   // Run
+   CHECK_THROWS_AS(pool->allocate(), std::bad_alloc);
+   bool threw{false};
+   std::thread other([pool, &threw]() {
+      try {
+         pool->allocate();
+      } catch (const std::bad_alloc&) {
+         threw = true;
+      }
+   });
+   other.join();
+   failingAllocationSize = 0;
+   NodePool::Stats stats = pool->stats();
+
+   // Test
+   CHECK(threw);
+   CHECK(stats.slabs == 0);
+   CHECK(stats.liveNodes == 0);
+   CHECK(stats.misses == 0);
+
+   // Cleanup (no reference is left behind, so the pool deletes itself here;
+   // a leak would be caught by valgrind)
+   pool->orphan();
+}
+// END ALLOCATE/RELEASE TESTS
+
+// THREAD TESTS
+TEST_CASE("NodePool::release accepts blocks from other threads while the owner allocates", "[NodePool]") {
+   // Setup
+   NodePool pool(24, 8);
+   std::vector<void*> handedOff;
+   for (int i = 0; i < 2000; ++i) {
+      handedOff.push_back(pool.allocate());
+   }
+
+   // Run - another thread releases every block while this one keeps allocating
+   std::thread releaser([&pool, &handedOff]() {
+      for (void* block : handedOff) {
+         pool.release(block);
+      }
+   });
+   std::vector<void*> kept;
+   for (int i = 0; i < 2000; ++i) {
+      kept.push_back(pool.allocate());
+      if (i % 2 == 0) {
+         pool.release(kept.back());
+         kept.pop_back();
+      }
+   }
+   releaser.join();
+
+   // Test - the blocks the other thread released are handed out again
+   std::vector<void*> recycled;
+   for (int i = 0; i < 2000; ++i) {
+      recycled.push_back(pool.allocate());
+   }
+   NodePool::Stats stats = pool.stats();
+   CHECK(stats.liveNodes == static_cast<int>(kept.size() + recycled.size()));
+   CHECK(stats.misses <= 4000);
+
+   // Cleanup
+   for (void* block : kept) {
+      pool.release(block);
+   }
+   for (void* block : recycled) {
+      pool.release(block);
+   }
+   CHECK(pool.stats().liveNodes == 0);
+}
+
+TEST_CASE("NodePool keeps an orphaned pool alive until threads release its last block", "[NodePool]") {
+   // Setup
+   NodePool* pool = new NodePool(24, 4);
+   std::vector<void*> blocks;
+   for (int i = 0; i < 400; ++i) {
+      blocks.push_back(pool->allocate());
+   }
+   pool->attach();
+
+   // Run - four threads release a quarter each, allocating and releasing as they go
+   pool->orphan();
+   std::vector<std::thread> releasers;
+   for (int t = 0; t < 4; ++t) {
+      releasers.emplace_back([pool, &blocks, t]() {
+         for (int i = t; i < 400; i += 4) {
+            pool->release(pool->allocate());
+            pool->release(blocks[i]);
+         }
+      });
+   }
+   for (std::thread& releaser : releasers) {
+      releaser.join();
+   }
+
+   // Test (the attached user keeps the pool alive; detaching deletes it, which
+   // a leak or double free would show under valgrind or the sanitizers)
+   CHECK(pool->stats().liveNodes == 0);
+   pool->detach();
+}
+// END THREAD TESTS
@@ -0,0 +1,111 @@
+/**
+ * @file ReducerTests.cpp
+ * @brief Defines catch2 unit tests for Reducer
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+
+#include "catch.hpp"        // catch2 required header
+#include "../Reducer.h"     // class being tested
+#include "TestHelpers.h"    // readInfiniteInt, printInfiniteInt and pseudoRandomDigits
+#include <string>           // std::string
+#include <thread>           // sharing one Reducer between threads
+#include <vector>           // results handed back from the threads
+
+// Checks that the Reducer agrees with operator% on value and its negation
+static void testReduceMatchesRemainder(const Reducer& reducer, const InfiniteInt& value) {
+   InfiniteInt negated = InfiniteInt(0) - value;
+   INFO(value.numDigits() << " digits mod " << reducer.modulus().numDigits() << " digits");
+   CHECK(printInfiniteInt(reducer.reduce(value)) == printInfiniteInt(value % reducer.modulus()));
+   CHECK(printInfiniteInt(reducer.reduce(negated)) == printInfiniteInt(negated % reducer.modulus()));
+}
+
+// CONSTRUCTOR TESTS
+TEST_CASE("Reducer keeps the modulus it was built from", "[Reducer]") {
+   InfiniteInt modulus = readInfiniteInt("-123456789012345678901234567890");
+   Reducer reducer(modulus);
+
+   CHECK(printInfiniteInt(reducer.modulus()) == "-123456789012345678901234567890");
+}
+
+TEST_CASE("Reducer rejects a zero modulus", "[Reducer]") {
+   CHECK_THROWS_AS(Reducer(InfiniteInt(0)), std::domain_error);
+}
+// END CONSTRUCTOR TESTS
+
+// REDUCE TESTS
+TEST_CASE("Reducer::reduce matches operator% for values up to twice the modulus's length", "[Reducer]") {
+   const int modulusSizes[] = { 1, 10, 19, 30, 100, 171, 400, 700 };
+   unsigned seed = 500;
+   for (int modulusSize : modulusSizes) {
+      Reducer reducer(readInfiniteInt(pseudoRandomDigits(modulusSize, seed++)));
+      for (int valueSize = 1; valueSize <= 2 * modulusSize; valueSize += 1 + modulusSize / 7) {
+         testReduceMatchesRemainder(reducer, readInfiniteInt(pseudoRandomDigits(valueSize, seed++)));
+      }
+      testReduceMatchesRemainder(reducer, reducer.modulus());
+      testReduceMatchesRemainder(reducer, reducer.modulus() * reducer.modulus() - InfiniteInt(1));
+   }
+}
+
+TEST_CASE("Reducer::reduce matches operator% for values many times the modulus's length", "[Reducer]") {
+   const int modulusSizes[] = { 5, 12, 40, 250 };
+   unsigned seed = 700;
+   for (int modulusSize : modulusSizes) {
+      Reducer reducer(readInfiniteInt(pseudoRandomDigits(modulusSize, seed++)));
+      for (int valueSize : { 3 * modulusSize, 5 * modulusSize + 4, 2000 }) {
+         testReduceMatchesRemainder(reducer, readInfiniteInt(pseudoRandomDigits(valueSize, seed++)));
+      }
+   }
+}
+
+TEST_CASE("Reducer::reduce handles negative moduli and exact multiples", "[Reducer]") {
+   InfiniteInt modulus = readInfiniteInt("-99999999999999999999999999999999999999");
+   Reducer reducer(modulus);
+   InfiniteInt multiple = modulus * readInfiniteInt(pseudoRandomDigits(120, 9));
+
+   CHECK(printInfiniteInt(reducer.reduce(multiple)) == "0");
+   CHECK(printInfiniteInt(reducer.reduce(multiple + InfiniteInt(5))) ==
+         printInfiniteInt((multiple + InfiniteInt(5)) % modulus));
+   testReduceMatchesRemainder(reducer, readInfiniteInt(pseudoRandomDigits(500, 10)));
+   CHECK(printInfiniteInt(Reducer(InfiniteInt(-7)).reduce(InfiniteInt(-30))) == "-2");
+}
+
+TEST_CASE("Reducer::reduce handles runs of nines that need every correction", "[Reducer]") {
+   for (int modulusSize : { 9, 18, 27, 90, 300 }) {
+      InfiniteInt nines = readInfiniteInt(std::string(modulusSize, '9'));
+      Reducer reducer(nines);
+      InfiniteInt value = readInfiniteInt(std::string(2 * modulusSize, '9'));
+      testReduceMatchesRemainder(reducer, value);
+      testReduceMatchesRemainder(reducer, nines * nines);
+      testReduceMatchesRemainder(reducer, readInfiniteInt("1" + std::string(2 * modulusSize - 1, '0')));
+   }
+}
+
+TEST_CASE("Reducer::reduce may be shared by threads whose results outlive them", "[Reducer]") {
+   // Setup
+   const Reducer reducer(readInfiniteInt(pseudoRandomDigits(60, 31)));
+   std::vector<InfiniteInt> values;
+   for (int i = 0; i < 40; ++i) {
+      values.push_back(readInfiniteInt(pseudoRandomDigits(100 + i, 40 + i)));
+   }
+
+   // Run - each thread reduces every fourth value; this thread checks and destroys the results
+   std::vector<InfiniteInt> results(values.size());
+   std::vector<std::thread> workers;
+   for (int t = 0; t < 4; ++t) {
+      workers.emplace_back([&reducer, &values, &results, t]() {
+         for (std::size_t i = t; i < values.size(); i += 4) {
+            results[i] = reducer.reduce(values[i]);
+         }
+      });
+   }
+   for (std::thread& worker : workers) {
+      worker.join();
+   }
+
+   // Test
+   for (std::size_t i = 0; i < values.size(); ++i) {
+      CHECK(printInfiniteInt(results[i]) == printInfiniteInt(values[i] % reducer.modulus()));
+   }
+}
+// END REDUCE TESTS
@@ -0,0 +1,41 @@
+/**
+ * @file TestHelpers.h
+ * @brief Helpers shared by the catch2 unit tests that build and check InfiniteInts
+ * @author Carl Mofjeld
+ * @date 10/16/2026
+*/
+
+#ifndef TESTHELPERS_H
+#define TESTHELPERS_H
+
+#include "../InfiniteInt.h"   // type the helpers build and print
+#include <sstream>            // allow testing of InfiniteInt contents via printing
+#include <string>             // std::string
+
+// Builds a number with the given # of pseudo-random digits (the same every run)
+inline std::string pseudoRandomDigits(int numDigits, unsigned seed) {
+   std::string digits;
+   for (int i = 0; i < numDigits; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      digits.push_back(static_cast<char>('0' + (seed >> 16) % 10));
+   }
+   digits[0] = static_cast<char>('1' + (seed >> 16) % 9);   // no leading zero
+   return digits;
+}
+
+// Reads an InfiniteInt from its decimal text
+inline InfiniteInt readInfiniteInt(const std::string& text) {
+   std::stringstream inputStream(text);
+   InfiniteInt result;
+   inputStream >> result;
+   return result;
+}
+
+// Prints an InfiniteInt to its decimal text
+inline std::string printInfiniteInt(const InfiniteInt& ii) {
+   std::stringstream output;
+   output << ii;
+   return output.str();
+}
+
+#endif
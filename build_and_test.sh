@@ -1,7 +1,11 @@
 #!/usr/bin/env bash
 
-# compile test code
-g++ -std=c++11 -g ./Tests/*.cpp InfiniteInt.cpp DEIntQueue.cpp -o ./Build/TestMain
+# compile test code (default circular-buffer storage, then unrolled-list storage, then binary limbs)
+g++ -std=c++11 -g ./Tests/*.cpp InfiniteInt.cpp ModularContext.cpp Reducer.cpp DEIntQueue.cpp NodePool.cpp -pthread -o ./Build/TestMain
+g++ -std=c++11 -g -DDEINTQUEUE_UNROLLED ./Tests/*.cpp InfiniteInt.cpp ModularContext.cpp Reducer.cpp DEIntQueue.cpp NodePool.cpp -pthread -o ./Build/TestMainUnrolled
+g++ -std=c++11 -g -DINFINITEINT_BINARY ./Tests/*.cpp InfiniteInt.cpp ModularContext.cpp Reducer.cpp DEIntQueue.cpp NodePool.cpp -pthread -o ./Build/TestMainBinary
 
 # run compiled tests
-valgrind ./Build/TestMain
\ No newline at end of file
+valgrind ./Build/TestMain
+valgrind ./Build/TestMainUnrolled
+valgrind ./Build/TestMainBinary
\ No newline at end of file